@@ -241,6 +241,10 @@ void registerAST(py::module_& m) {
         .def_readonly("sourceRange", &TimingControl::sourceRange)
         .def_property_readonly("bad", &TimingControl::bad)
         .def("visit", &pyASTVisit<TimingControl>, "f"_a, PyASTVisitor::doc)
+        .def("visit", &pyASTFilteredVisit<TimingControl>, "f"_a, AST_FILTER_ARGS,
+             PyASTFilterVisitor::visitDoc)
+        .def("collect", &pyASTCollect<TimingControl>, AST_FILTER_ARGS,
+             PyASTFilterVisitor::collectDoc)
         .def("__repr__", [](const TimingControl& self) {
             return fmt::format("TimingControl(TimingControlKind.{})", toString(self.kind));
         });
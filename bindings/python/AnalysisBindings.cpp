@@ -60,9 +60,9 @@ void registerAnalysis(py::module_& m) {
 
     py::classh<AnalysisManager>(m, "AnalysisManager")
         .def(py::init<AnalysisOptions>(), "options"_a = AnalysisOptions())
-        .def("analyze", &AnalysisManager::analyze, "compilation"_a)
+        .def("analyze", &AnalysisManager::analyze, "compilation"_a, nogil())
         .def("getDrivers", &AnalysisManager::getDrivers, "symbol"_a, byrefint)
-        .def("getDiagnostics", &AnalysisManager::getDiagnostics, "sourceManager"_a)
+        .def("getDiagnostics", &AnalysisManager::getDiagnostics, "sourceManager"_a, nogil())
         .def("analyzeScopeBlocking", &AnalysisManager::analyzeScopeBlocking, "scope"_a,
              "parentProcedure"_a = nullptr, byrefint)
         .def("getAnalyzedScope", &AnalysisManager::getAnalyzedScope, "scope"_a, byrefint)
@@ -78,7 +78,12 @@ void registerCompilation(py::module_& m) {
         .def_readwrite("paramOverrides", &CompilationOptions::paramOverrides)
         .def_readwrite("defaultLiblist", &CompilationOptions::defaultLiblist);
 
-    py::classh<Compilation> comp(m, "Compilation");
+    py::classh<Compilation> comp(
+        m, "Compilation",
+        "A Compilation is not thread safe. Several threads may each work on their own "
+        "Compilation at the same time, but a single Compilation must not be used from more "
+        "than one thread at once, because methods such as getRoot and getAllDiagnostics "
+        "release the GIL while they run.");
     comp.def(py::init<>())
         .def(py::init<const Bag&>(), "options"_a)
         .def_property_readonly("options", &Compilation::getOptions)
@@ -88,7 +93,7 @@ void registerCompilation(py::module_& m) {
         .def_property_readonly("defaultLibrary", &Compilation::getDefaultLibrary)
         .def("addSyntaxTree", &Compilation::addSyntaxTree, "tree"_a)
         .def("getSyntaxTrees", &Compilation::getSyntaxTrees)
-        .def("getRoot", py::overload_cast<>(&Compilation::getRoot), byrefint)
+        .def("getRoot", py::overload_cast<>(&Compilation::getRoot), byrefint, nogil())
         .def("addSystemSubroutine", &Compilation::addSystemSubroutine, py::keep_alive<1, 2>(),
              "subroutine"_a)
         .def("addSystemMethod", &Compilation::addSystemMethod, py::keep_alive<1, 3>(), "typeKind"_a,
@@ -100,9 +105,9 @@ void registerCompilation(py::module_& m) {
         .def("parseName", &Compilation::parseName, byrefint, "name"_a)
         .def("tryParseName", &Compilation::tryParseName, byrefint, "name"_a, "diags"_a)
         .def("createScriptScope", &Compilation::createScriptScope, byrefint)
-        .def("getParseDiagnostics", &Compilation::getParseDiagnostics, byrefint)
-        .def("getSemanticDiagnostics", &Compilation::getSemanticDiagnostics, byrefint)
-        .def("getAllDiagnostics", &Compilation::getAllDiagnostics, byrefint)
+        .def("getParseDiagnostics", &Compilation::getParseDiagnostics, byrefint, nogil())
+        .def("getSemanticDiagnostics", &Compilation::getSemanticDiagnostics, byrefint, nogil())
+        .def("getAllDiagnostics", &Compilation::getAllDiagnostics, byrefint, nogil())
         .def("addDiagnostics", &Compilation::addDiagnostics, "diagnostics"_a)
         .def("getCompilationUnit", &Compilation::getCompilationUnit, byrefint, "syntax"_a)
         .def("getCompilationUnits", &Compilation::getCompilationUnits, byrefint)
@@ -155,7 +160,11 @@ void registerCompilation(py::module_& m) {
 
     py::classh<ScriptSession>(m, "ScriptSession")
         .def(py::init<>())
-        .def_readonly("compilation", &ScriptSession::compilation)
+        .def(py::init<Compilation&, const Scope*>(), "compilation"_a, "lookupScope"_a = nullptr,
+             py::keep_alive<1, 2>())
+        .def_property_readonly(
+            "compilation", [](ScriptSession& self) -> Compilation& { return self.compilation; },
+            byrefint)
         .def("eval", &ScriptSession::eval, "text"_a)
         .def("evalExpression", &ScriptSession::evalExpression, "expr"_a)
         .def("evalStatement", &ScriptSession::evalStatement, "expr"_a)
@@ -174,7 +183,11 @@ void registerCompilation(py::module_& m) {
         .value("Default", LanguageVersion::Default)
         .finalize();
 
-    py::classh<Driver>(m, "Driver")
+    py::classh<Driver>(m, "Driver",
+                       "A Driver is not thread safe. Several threads may each use their own "
+                       "Driver at the same time, but a single Driver (and the Compilation it "
+                       "creates) must not be used from more than one thread at once, because "
+                       "its long-running methods release the GIL while they run.")
         .def(py::init<>())
         .def_readonly("sourceManager", &Driver::sourceManager)
         .def_readonly("diagEngine", &Driver::diagEngine)
@@ -193,17 +206,21 @@ void registerCompilation(py::module_& m) {
              "separateUnit"_a)
         .def("processOptions", &Driver::processOptions)
         .def("runPreprocessor", &Driver::runPreprocessor, "includeComments"_a,
-             "includeDirectives"_a, "obfuscateIds"_a, "useFixedObfuscationSeed"_a = false)
+             "includeDirectives"_a, "obfuscateIds"_a, "useFixedObfuscationSeed"_a = false,
+             nogil())
+        .def("runPreprocessorPerUnit", &Driver::runPreprocessorPerUnit, "outputDir"_a,
+             "includeComments"_a, "includeDirectives"_a, "obfuscateIds"_a,
+             "useFixedObfuscationSeed"_a = false, nogil())
         .def("reportMacros", &Driver::reportMacros)
         .def("optionallyWriteDepFiles", &Driver::optionallyWriteDepFiles)
-        .def("parseAllSources", &Driver::parseAllSources)
+        .def("parseAllSources", &Driver::parseAllSources, nogil())
         .def("createOptionBag", &Driver::createOptionBag)
-        .def("createCompilation", &Driver::createCompilation)
+        .def("createCompilation", &Driver::createCompilation, nogil())
         .def("reportParseDiags", &Driver::reportParseDiags)
-        .def("reportCompilation", &Driver::reportCompilation, "compilation"_a, "quiet"_a)
-        .def("runAnalysis", &Driver::runAnalysis, "compilation"_a)
-        .def("reportDiagnostics", &Driver::reportDiagnostics, "quiet"_a)
-        .def("runFullCompilation", &Driver::runFullCompilation, "quiet"_a = false);
+        .def("reportCompilation", &Driver::reportCompilation, "compilation"_a, "quiet"_a, nogil())
+        .def("runAnalysis", &Driver::runAnalysis, "compilation"_a, nogil())
+        .def("reportDiagnostics", &Driver::reportDiagnostics, "quiet"_a, nogil())
+        .def("runFullCompilation", &Driver::runFullCompilation, "quiet"_a = false, nogil());
 
     py::classh<SourceOptions>(m, "SourceOptions")
         .def(py::init<>())
@@ -36,6 +36,10 @@ void registerExpressions(py::module_& m) {
         .def("getSymbolReference", &Expression::getSymbolReference, byrefint,
              "allowPacked"_a = true)
         .def("visit", &pyASTVisit<Expression>, "f"_a, PyASTVisitor::doc)
+        .def("visit", &pyASTFilteredVisit<Expression>, "f"_a, AST_FILTER_ARGS,
+             PyASTFilterVisitor::visitDoc)
+        .def("collect", &pyASTCollect<Expression>, AST_FILTER_ARGS,
+             PyASTFilterVisitor::collectDoc)
         .def("__repr__", [](const Expression& self) {
             return fmt::format("Expression(ExpressionKind.{})", toString(self.kind));
         });
@@ -5,6 +5,9 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <optional>
+#include <vector>
+
 #include "pyslang.h"
 
 #include "slang/ast/ASTVisitor.h"
@@ -56,3 +59,176 @@ void pyASTVisit(const T& t, py::object f) {
     PyASTVisitor visitor{f};
     t.visit(visitor);
 }
+
+/// A set of node kinds that a filtered visit should report.
+/// A filter that was not provided matches nothing, unless no filters
+/// were provided at all, in which case every node matches.
+template<typename TKind>
+class KindFilter {
+public:
+    explicit KindFilter(const std::optional<std::vector<TKind>>& kinds) {
+        if (!kinds)
+            return;
+
+        provided = true;
+        for (auto kind : *kinds) {
+            auto index = size_t(kind);
+            if (index >= bits.size())
+                bits.resize(index + 1);
+            bits[index] = true;
+        }
+    }
+
+    bool isProvided() const { return provided; }
+
+    bool contains(TKind kind, bool matchAll) const {
+        if (matchAll)
+            return true;
+
+        auto index = size_t(kind);
+        return index < bits.size() && bits[index];
+    }
+
+private:
+    std::vector<bool> bits;
+    bool provided = false;
+};
+
+using SymbolKindList = std::optional<std::vector<SymbolKind>>;
+using ExpressionKindList = std::optional<std::vector<ExpressionKind>>;
+using StatementKindList = std::optional<std::vector<StatementKind>>;
+
+/// Walks the AST natively and only reports nodes that match the given kind
+/// filters (and scope prefix, if there is one). Matching nodes are passed to
+/// the callback, or collected into a list if no callback is given, so that
+/// Python code interested in a handful of node kinds doesn't pay for a Python
+/// call on every node in the design.
+struct PyASTFilterVisitor : public ASTVisitor<PyASTFilterVisitor, true, true> {
+    KindFilter<SymbolKind> symbolKinds;
+    KindFilter<ExpressionKind> expressionKinds;
+    KindFilter<StatementKind> statementKinds;
+    std::string_view scopePrefix;
+    py::object f;
+    py::list results;
+    bool matchAll;
+    bool inScope;
+    bool interrupted = false;
+
+    static inline constexpr auto visitDoc =
+        "Visit a pyslang object with a callback function `f`, which is only invoked "
+        "for nodes that match the given filters.\n\n"
+        "The walk itself happens natively. A node matches if its kind is in "
+        "`symbolKinds`, `expressionKinds`, or `statementKinds`; if none of these are "
+        "given, every node matches. If `scopePrefix` is the hierarchical path of a "
+        "scope, such as `top.cpu`, only nodes within that part of the design hierarchy "
+        "are reported; the rest of the design is not walked, and hierarchical paths are "
+        "only computed for the scopes and instances passed on the way.\n\n"
+        "The return value of `f` is interpreted the same way as for the unfiltered `visit`.";
+
+    static inline constexpr auto collectDoc =
+        "Walk a pyslang object natively and return a list of all nodes that match the "
+        "given filters, which work the same way as for the filtered `visit`.";
+
+    PyASTFilterVisitor(py::object f, const SymbolKindList& symbolKinds,
+                       const ExpressionKindList& expressionKinds,
+                       const StatementKindList& statementKinds, std::string_view scopePrefix) :
+        symbolKinds(symbolKinds), expressionKinds(expressionKinds),
+        statementKinds(statementKinds), scopePrefix(scopePrefix), f(std::move(f)) {
+        matchAll = !this->symbolKinds.isProvided() && !this->expressionKinds.isProvided() &&
+                   !this->statementKinds.isProvided();
+        inScope = scopePrefix.empty();
+    }
+
+    template<typename T>
+    void handle(const T& t) {
+        if (interrupted)
+            return;
+
+        if constexpr (std::is_base_of_v<Symbol, T>) {
+            if (inScope || t.kind == SymbolKind::Root || t.kind == SymbolKind::CompilationUnit) {
+                report(t, inScope && symbolKinds.contains(t.kind, matchAll));
+                return;
+            }
+
+            // Only scopes and instances can lead down to the prefix, so skip
+            // anything else without paying to compute its path.
+            if (!t.isScope() && t.kind != SymbolKind::Instance)
+                return;
+
+            // Everything under a symbol whose path starts with the prefix is in
+            // scope. Otherwise only descend if this symbol is an ancestor of the
+            // scope we're looking for.
+            auto path = t.getHierarchicalPath();
+            if (isWithin(path, scopePrefix)) {
+                inScope = true;
+                report(t, symbolKinds.contains(t.kind, matchAll));
+                inScope = false;
+            }
+            else if (isWithin(scopePrefix, path)) {
+                this->visitDefault(t);
+            }
+        }
+        else if constexpr (std::is_base_of_v<Expression, T>) {
+            report(t, inScope && expressionKinds.contains(t.kind, matchAll));
+        }
+        else if constexpr (std::is_base_of_v<Statement, T>) {
+            report(t, inScope && statementKinds.contains(t.kind, matchAll));
+        }
+        else {
+            report(t, false);
+        }
+    }
+
+private:
+    template<typename T>
+    void report(const T& t, bool matches) {
+        if (matches) {
+            if (f.is_none()) {
+                results.append(py::cast(&t, byref));
+            }
+            else {
+                py::object result = f(&t);
+                if (result.equal(py::cast(VisitAction::Interrupt))) {
+                    interrupted = true;
+                    return;
+                }
+                if (result.equal(py::cast(VisitAction::Skip)))
+                    return;
+            }
+        }
+        this->visitDefault(t);
+    }
+
+    static bool isWithin(std::string_view path, std::string_view prefix) {
+        if (!path.starts_with(prefix))
+            return false;
+        if (path.size() == prefix.size())
+            return true;
+
+        auto c = path[prefix.size()];
+        return c == '.' || c == '[' || c == ':';
+    }
+};
+
+template<typename T>
+void pyASTFilteredVisit(const T& t, py::object f, const SymbolKindList& symbolKinds,
+                        const ExpressionKindList& expressionKinds,
+                        const StatementKindList& statementKinds, std::string_view scopePrefix) {
+    PyASTFilterVisitor visitor{f, symbolKinds, expressionKinds, statementKinds, scopePrefix};
+    t.visit(visitor);
+}
+
+template<typename T>
+py::list pyASTCollect(const T& t, const SymbolKindList& symbolKinds,
+                      const ExpressionKindList& expressionKinds,
+                      const StatementKindList& statementKinds, std::string_view scopePrefix) {
+    PyASTFilterVisitor visitor{py::none(), symbolKinds, expressionKinds, statementKinds,
+                               scopePrefix};
+    t.visit(visitor);
+    return std::move(visitor.results);
+}
+
+// The keyword arguments shared by the filtered `visit` and `collect` methods.
+#define AST_FILTER_ARGS                                                                    \
+    py::kw_only(), "symbolKinds"_a = py::none(), "expressionKinds"_a = py::none(),        \
+        "statementKinds"_a = py::none(), "scopePrefix"_a = ""
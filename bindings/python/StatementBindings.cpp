@@ -23,6 +23,10 @@ void registerStatements(py::module_& m) {
         .def_property_readonly("bad", &Statement::bad)
         .def("eval", &Statement::eval, "context"_a)
         .def("visit", &pyASTVisit<Statement>, "f"_a, PyASTVisitor::doc)
+        .def("visit", &pyASTFilteredVisit<Statement>, "f"_a, AST_FILTER_ARGS,
+             PyASTFilterVisitor::visitDoc)
+        .def("collect", &pyASTCollect<Statement>, AST_FILTER_ARGS,
+             PyASTFilterVisitor::collectDoc)
         .def("__repr__", [](const Statement& self) {
             return fmt::format("Statement(StatementKind.{})", toString(self.kind));
         });
@@ -131,6 +131,10 @@ void registerSymbols(py::module_& m) {
         .def("isDeclaredBefore",
              py::overload_cast<LookupLocation>(&Symbol::isDeclaredBefore, py::const_), "location"_a)
         .def("visit", &pyASTVisit<Symbol>, "f"_a, PyASTVisitor::doc)
+        .def("visit", &pyASTFilteredVisit<Symbol>, "f"_a, AST_FILTER_ARGS,
+             PyASTFilterVisitor::visitDoc)
+        .def("collect", &pyASTCollect<Symbol>, AST_FILTER_ARGS,
+             PyASTFilterVisitor::collectDoc)
         .def("__repr__", [](const Symbol& self) {
             return fmt::format("Symbol(SymbolKind.{}, \"{}\")", toString(self.kind), self.name);
         });
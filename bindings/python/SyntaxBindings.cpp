@@ -6,6 +6,10 @@
 #include "PyVisitors.h"
 #include "pyslang.h"
 
+#if defined(SLANG_USE_THREADS)
+#    include <BS_thread_pool.hpp>
+#endif
+
 #include "slang/parsing/Lexer.h"
 #include "slang/parsing/Parser.h"
 #include "slang/parsing/Preprocessor.h"
@@ -57,6 +61,65 @@ void pySyntaxVisit(const SyntaxNode& sn, py::object f) {
     sn.visit(visitor);
 }
 
+// Walks a syntax tree natively and only reports nodes of the given kinds,
+// either to a callback or by collecting them into a list.
+struct PySyntaxFilterVisitor : public SyntaxVisitor<PySyntaxFilterVisitor> {
+    KindFilter<SyntaxKind> kinds;
+    py::object f;
+    py::list results;
+    bool interrupted = false;
+
+    static inline constexpr auto visitDoc =
+        "Visit a pyslang object with a callback function `f`, which is only invoked "
+        "for syntax nodes whose kind is in `kinds`. The walk itself happens natively "
+        "and tokens are not reported.\n\n"
+        "The return value of `f` is interpreted the same way as for the unfiltered `visit`.";
+
+    static inline constexpr auto collectDoc =
+        "Walk a pyslang object natively and return a list of all syntax nodes whose "
+        "kind is in `kinds`.";
+
+    PySyntaxFilterVisitor(py::object f, const std::vector<SyntaxKind>& kinds) :
+        kinds(kinds), f(std::move(f)) {}
+
+    template<typename T>
+    void handle(const T& t) {
+        if (interrupted)
+            return;
+
+        if (kinds.contains(t.kind, false)) {
+            // As with PySyntaxVisitor, hand Python a SyntaxNode so that
+            // it goes through the polymorphic downcaster.
+            auto node = static_cast<const SyntaxNode*>(&t);
+            if (f.is_none()) {
+                results.append(py::cast(node, byref));
+            }
+            else {
+                py::object result = f(node);
+                if (result.equal(py::cast(VisitAction::Interrupt))) {
+                    interrupted = true;
+                    return;
+                }
+                if (result.equal(py::cast(VisitAction::Skip)))
+                    return;
+            }
+        }
+        this->visitDefault(t);
+    }
+};
+
+void pySyntaxFilteredVisit(const SyntaxNode& sn, py::object f,
+                           const std::vector<SyntaxKind>& kinds) {
+    PySyntaxFilterVisitor visitor{f, kinds};
+    sn.visit(visitor);
+}
+
+py::list pySyntaxCollect(const SyntaxNode& sn, const std::vector<SyntaxKind>& kinds) {
+    PySyntaxFilterVisitor visitor{py::none(), kinds};
+    sn.visit(visitor);
+    return std::move(visitor.results);
+}
+
 class PySyntaxRewriter : public SyntaxRewriter<PySyntaxRewriter> {
 public:
     PySyntaxRewriter(pybind11::function handler) : handler(std::move(handler)) {}
@@ -255,6 +318,10 @@ void registerSyntax(py::module_& m) {
         .def("getLastToken", &SyntaxNode::getLastToken)
         .def("isEquivalentTo", &SyntaxNode::isEquivalentTo, "other"_a)
         .def("visit", &pySyntaxVisit, "f"_a, PySyntaxVisitor::doc)
+        .def("visit", &pySyntaxFilteredVisit, "f"_a, py::kw_only(), "kinds"_a,
+             PySyntaxFilterVisitor::visitDoc)
+        .def("collect", &pySyntaxCollect, py::kw_only(), "kinds"_a,
+             PySyntaxFilterVisitor::collectDoc)
         .def_property_readonly("sourceRange", &SyntaxNode::sourceRange)
         .def("__getitem__",
              [](const SyntaxNode& self, size_t i) -> py::object {
@@ -291,7 +358,7 @@ void registerSyntax(py::module_& m) {
                 serializer.serialize(self);
                 return std::string(writer.view());
             },
-            py::arg("mode") = CSTJsonMode::Full,
+            py::arg("mode") = CSTJsonMode::Full, nogil(),
             "Convert this syntax node to JSON string with optional formatting mode");
 
     py::classh<IncludeMetadata>(m, "IncludeMetadata")
@@ -311,7 +378,7 @@ void registerSyntax(py::module_& m) {
                     throw fs::filesystem_error("", path, result.error().first);
                 return *result;
             },
-            "path"_a)
+            "path"_a, nogil())
         .def_static(
             "fromFile",
             [](std::string_view path, SourceManager& sourceManager, const Bag& options) {
@@ -320,7 +387,7 @@ void registerSyntax(py::module_& m) {
                     throw fs::filesystem_error("", path, result.error().first);
                 return *result;
             },
-            py::keep_alive<0, 2>(), "path"_a, "sourceManager"_a, "options"_a = Bag())
+            py::keep_alive<0, 2>(), "path"_a, "sourceManager"_a, "options"_a = Bag(), nogil())
         .def_static(
             "fromFiles",
             [](std::span<const std::string_view> paths) {
@@ -329,7 +396,7 @@ void registerSyntax(py::module_& m) {
                     throw fs::filesystem_error("", result.error().second, result.error().first);
                 return *result;
             },
-            "paths"_a)
+            "paths"_a, nogil())
         .def_static(
             "fromFiles",
             [](std::span<const std::string_view> paths, SourceManager& sourceManager,
@@ -339,17 +406,67 @@ void registerSyntax(py::module_& m) {
                     throw fs::filesystem_error("", result.error().second, result.error().first);
                 return *result;
             },
-            py::keep_alive<0, 2>(), "paths"_a, "sourceManager"_a, "options"_a = Bag())
+            py::keep_alive<0, 2>(), "paths"_a, "sourceManager"_a, "options"_a = Bag(), nogil())
+        .def_static(
+            "fromFilesInParallel",
+            [](const std::vector<std::string>& paths, SourceManager& sourceManager,
+               const Bag& options, uint32_t numThreads) {
+                std::vector<std::shared_ptr<SyntaxTree>> results(paths.size());
+                std::vector<std::error_code> errors(paths.size());
+                {
+                    py::gil_scoped_release release;
+                    auto parse = [&](size_t i) {
+                        auto result = SyntaxTree::fromFile(paths[i], sourceManager, options);
+                        if (result)
+                            results[i] = *result;
+                        else
+                            errors[i] = result.error().first;
+                    };
+
+#if defined(SLANG_USE_THREADS)
+                    BS::thread_pool<> threadPool(numThreads);
+                    threadPool.detach_loop(size_t(0), paths.size(), parse);
+                    threadPool.wait();
+#else
+                    (void)numThreads;
+                    for (size_t i = 0; i < paths.size(); i++)
+                        parse(i);
+#endif
+                }
+
+                for (size_t i = 0; i < paths.size(); i++) {
+                    if (errors[i])
+                        throw fs::filesystem_error("", paths[i], errors[i]);
+                }
+
+                // A list can't be weakly referenced, so rather than keep_alive on the
+                // return value each tree keeps the source manager alive on its own, via
+                // the same keep_alive policy that fromFile uses, applied by passing it
+                // through an identity function.
+                py::cpp_function keepSourceManagerAlive(
+                    [](py::object tree, py::handle) { return tree; }, py::keep_alive<0, 2>());
+
+                auto sourceManagerObj = py::cast(&sourceManager,
+                                                 py::return_value_policy::reference);
+                py::list list;
+                for (auto& tree : results)
+                    list.append(keepSourceManagerAlive(py::cast(tree), sourceManagerObj));
+                return list;
+            },
+            "paths"_a, "sourceManager"_a, "options"_a = Bag(), "numThreads"_a = 0,
+            "Parses each of the given files into its own syntax tree, in parallel on a "
+            "pool of numThreads threads (0 means one per hardware thread), and returns "
+            "the trees in the same order as the paths. The GIL is released while parsing.")
         .def_static("fromText",
                     py::overload_cast<std::string_view, std::string_view, std::string_view>(
                         &SyntaxTree::fromText),
-                    "text"_a, "name"_a = "source", "path"_a = "")
+                    "text"_a, "name"_a = "source", "path"_a = "", nogil())
         .def_static("fromText",
                     py::overload_cast<std::string_view, SourceManager&, std::string_view,
                                       std::string_view, const Bag&, const SourceLibrary*>(
                         &SyntaxTree::fromText),
                     py::keep_alive<0, 2>(), "text"_a, "sourceManager"_a, "name"_a = "source",
-                    "path"_a = "", "options"_a = Bag(), "library"_a = nullptr)
+                    "path"_a = "", "options"_a = Bag(), "library"_a = nullptr, nogil())
         .def_static("fromFileInMemory", &SyntaxTree::fromFileInMemory, py::keep_alive<0, 2>(),
                     "text"_a, "sourceManager"_a, "name"_a = "source", "path"_a = "",
                     "options"_a = Bag())
@@ -383,7 +500,7 @@ void registerSyntax(py::module_& m) {
                 serializer.serialize(self);
                 return std::string(writer.view());
             },
-            py::arg("mode") = CSTJsonMode::Full,
+            py::arg("mode") = CSTJsonMode::Full, nogil(),
             "Convert this syntax tree to JSON string with optional formatting mode");
 
     py::classh<LexerOptions>(m, "LexerOptions")
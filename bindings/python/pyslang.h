@@ -45,6 +45,17 @@ using namespace slang::ast;
 static constexpr auto byref = py::return_value_policy::reference;
 static constexpr auto byrefint = py::return_value_policy::reference_internal;
 
+// Releases the GIL for the duration of a long running call (parsing, elaboration,
+// analysis, serialization) so that other Python threads can make progress.
+// Only use this for calls that don't touch Python objects; callbacks into
+// Python overrides reacquire the GIL on their own.
+//
+// Releasing the GIL means that nothing serializes access to the underlying C++
+// object anymore. That's fine for separate objects, but types like Compilation
+// and Driver are not thread safe, so their docstrings state that one instance
+// must not be shared between threads.
+using nogil = py::call_guard<py::gil_scoped_release>;
+
 namespace pybind11 {
 namespace detail {
 
@@ -16,6 +16,8 @@
 
 namespace slang::analysis {
 
+class AnalysisManager;
+
 using namespace ast;
 
 /// A base class for flow analysis passes that contains
@@ -56,6 +58,10 @@ protected:
     /// analysis will be added to it.
     Diagnostics* diagnostics;
 
+    /// An optional analysis manager. If provided, it's used to share the results
+    /// of expensive case statement analysis between different analyses.
+    AnalysisManager* analysisManager = nullptr;
+
     /// An EvalContext that can be used for constant evaluation during analysis.
     mutable EvalContext evalContext;
 };
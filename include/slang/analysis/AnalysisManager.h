@@ -10,11 +10,14 @@
 #if defined(SLANG_USE_THREADS)
 #    include <BS_thread_pool.hpp>
 #endif
+#include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 
 #include "slang/analysis/AnalysisOptions.h"
 #include "slang/analysis/AnalyzedProcedure.h"
+#include "slang/analysis/CaseDecisionDag.h"
 #include "slang/analysis/DriverTracker.h"
 #include "slang/diagnostics/Diagnostics.h"
 #include "slang/util/BumpAllocator.h"
@@ -162,6 +165,12 @@ public:
     const AnalyzedProcedure* addAnalyzedSubroutine(const ast::SubroutineSymbol& symbol,
                                                    std::unique_ptr<AnalyzedProcedure> procedure);
 
+    /// Gets a decision DAG for the given case statement clauses. Results are cached,
+    /// so identical sets of clauses (such as a large decoder table in a module that
+    /// is instantiated with many different parameter values) are only analyzed once.
+    std::shared_ptr<const CaseDecisionDag> getCaseDecisionDag(std::span<const SVInt> clauses,
+                                                              uint32_t bitWidth, bool wildcardX);
+
     /// Notes that the given expression is a driver and should be added to the driver tracker.
     void noteDriver(const ast::Expression& expr, const ast::Symbol& containingSymbol);
 
@@ -190,17 +199,55 @@ private:
         WorkerState(AnalysisManager& manager) : context(manager), driverAlloc(context.alloc) {}
     };
 
+    struct CaseDagKey {
+        std::vector<SVInt> clauses;
+        uint32_t bitWidth;
+        bool wildcardX;
+
+        bool operator==(const CaseDagKey& other) const;
+    };
+
+    struct CaseDagKeyHash {
+        size_t operator()(const CaseDagKey& key) const;
+    };
+
+    // Summarizes everything that happens as a result of calling a subroutine:
+    // the subroutine itself along with every subroutine it transitively calls,
+    // in depth-first order. This is computed once per subroutine and then
+    // applied at each call site, instead of re-walking the call graph for
+    // every caller.
+    struct SubroutineSummary {
+        struct Callee {
+            not_null<const ast::SubroutineSymbol*> subroutine;
+            not_null<const AnalyzedProcedure*> analysis;
+
+            // The call expression that reached this subroutine, or nullptr
+            // for the summarized subroutine itself.
+            const ast::CallExpression* call;
+        };
+        std::vector<Callee> callees;
+    };
+
     PendingAnalysis analyzeSymbol(const ast::Symbol& symbol);
     void analyzeScopeAsync(const ast::Scope& scope);
     void wait();
     WorkerState& getState();
 
+    const AnalyzedProcedure& getOrAnalyzeSubroutine(const ast::SubroutineSymbol& symbol);
+    const SubroutineSummary& getSubroutineSummary(const ast::SubroutineSymbol& symbol);
+    void collectCallees(const ast::SubroutineSymbol& symbol, const ast::CallExpression* call,
+                        SmallSet<const ast::SubroutineSymbol*, 4>& visited,
+                        std::vector<SubroutineSummary::Callee>& callees);
+
     const AnalysisOptions options;
     std::vector<WorkerState> workerStates;
 
     concurrent_map<const ast::Scope*, std::optional<const AnalyzedScope*>> analyzedScopes;
     concurrent_map<const ast::SubroutineSymbol*, std::unique_ptr<AnalyzedProcedure>>
         analyzedSubroutines;
+    concurrent_map<const ast::SubroutineSymbol*, std::unique_ptr<SubroutineSummary>>
+        subroutineSummaries;
+    concurrent_map<CaseDagKey, std::shared_ptr<const CaseDecisionDag>, CaseDagKeyHash> caseDags;
 
     DriverTracker driverTracker;
 
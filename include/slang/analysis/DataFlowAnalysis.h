@@ -23,14 +23,36 @@ using SymbolLSPMap = IntervalMap<uint64_t, const Expression*, 5>;
 /// Represents the state of a data flow analysis at a single point in a procedure.
 struct SLANG_EXPORT DataFlowState {
     /// Each tracked variable has its assigned intervals stored here.
+    /// Variables that are wholly assigned are instead recorded in
+    /// @a fullyAssigned and leave their interval map empty.
     SmallVector<SymbolBitMap, 2> assigned;
 
+    /// A dense bit set, indexed by variable slot, of variables whose entire
+    /// extent is definitely assigned. This is by far the most common case
+    /// and lets joins and meets operate on whole words at a time instead
+    /// of walking interval maps.
+    SmallVector<uint64_t, 2> fullyAssigned;
+
     /// Whether the control flow that arrived at this point is reachable.
     bool reachable = true;
 
     DataFlowState() = default;
     DataFlowState(DataFlowState&& other) = default;
     DataFlowState& operator=(DataFlowState&& other) = default;
+
+    /// Returns true if the variable in the given slot is wholly assigned.
+    bool isFullyAssigned(size_t index) const {
+        auto word = index / 64;
+        return word < fullyAssigned.size() && (fullyAssigned[word] >> (index % 64)) & 1;
+    }
+
+    /// Marks the variable in the given slot as wholly assigned.
+    void setFullyAssigned(size_t index) {
+        auto word = index / 64;
+        if (word >= fullyAssigned.size())
+            fullyAssigned.resize(word + 1);
+        fullyAssigned[word] |= uint64_t(1) << (index % 64);
+    }
 };
 
 /// Performs data flow analysis on a single procedure, tracking the assigned ranges
@@ -94,7 +116,11 @@ public:
         not_null<const ValueSymbol*> symbol;
         SymbolLSPMap assigned;
 
-        LValueSymbol(const ValueSymbol& symbol) : symbol(&symbol) {}
+        // The bounds that cover the entire symbol.
+        std::pair<uint64_t, uint64_t> wholeBounds;
+
+        LValueSymbol(const ValueSymbol& symbol, std::pair<uint64_t, uint64_t> wholeBounds) :
+            symbol(&symbol), wholeBounds(wholeBounds) {}
     };
 
     /// Gets all of the lvalues used in the procedure.
@@ -215,6 +241,10 @@ void DataFlowAnalysis::visitPartiallyAssigned(bool skipAutomatic, F&& func) cons
         auto& left = symbolState.assigned;
         SLANG_ASSERT(!left.empty());
 
+        // If the whole variable is assigned then every range is covered.
+        if (currState.isFullyAssigned(index))
+            continue;
+
         // Each interval in the left map is a range that needs to be fully covered
         // by our final state, otherwise that interval is not fully assigned.
         if (currState.assigned.size() <= index) {
@@ -243,7 +273,9 @@ void DataFlowAnalysis::visitPartiallyAssigned(bool skipAutomatic, F&& func) cons
 template<typename F>
 void DataFlowAnalysis::visitDefinitelyAssigned(bool skipAutomatic, F&& func) const {
     auto& currState = getState();
-    for (size_t index = 0; index < currState.assigned.size(); index++) {
+    auto numSlots = std::min(lvalues.size(),
+                             std::max(currState.assigned.size(), currState.fullyAssigned.size() * 64));
+    for (size_t index = 0; index < numSlots; index++) {
         auto& symbolState = lvalues[index];
         auto& symbol = *symbolState.symbol;
 
@@ -252,13 +284,12 @@ void DataFlowAnalysis::visitDefinitelyAssigned(bool skipAutomatic, F&& func) con
             continue;
         }
 
-        auto& imap = currState.assigned[index];
-        for (auto it = imap.begin(); it != imap.end(); ++it) {
+        auto visitRange = [&](std::pair<uint64_t, uint64_t> bounds) {
             // We know this range is definitely assigned. In order to provide an
             // example expression for the LSP we need to look up a range that
             // overlaps from the procedure-wide tracking map.
             std::optional<std::pair<uint64_t, uint64_t>> prevBounds;
-            for (auto lspIt = symbolState.assigned.find(it.bounds());
+            for (auto lspIt = symbolState.assigned.find(bounds);
                  lspIt != symbolState.assigned.end(); ++lspIt) {
                 // Skip over ranges that partially overlap previously visited ranges,
                 // as it's not clear that there's additional value in reporting them.
@@ -270,6 +301,17 @@ void DataFlowAnalysis::visitDefinitelyAssigned(bool skipAutomatic, F&& func) con
 
                 prevBounds = curBounds;
             }
+        };
+
+        if (currState.isFullyAssigned(index)) {
+            visitRange(symbolState.wholeBounds);
+            continue;
+        }
+
+        if (index < currState.assigned.size()) {
+            auto& imap = currState.assigned[index];
+            for (auto it = imap.begin(); it != imap.end(); ++it)
+                visitRange(it.bounds());
         }
     }
 }
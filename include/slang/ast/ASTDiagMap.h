@@ -25,10 +25,15 @@ public:
 
     /// Coalesces all issued diagnostics into a set that is ready for presenting.
     /// If the @a sourceManager is provided it will be used to sort the diagnostics.
-    Diagnostics coalesce(const SourceManager* sourceManager);
+    ///
+    /// If there are many distinct diagnostics and @a numThreads is not 1, the work
+    /// is split across a pool of that many threads (zero means one per hardware
+    /// thread). The result is the same regardless of the number of threads used.
+    Diagnostics coalesce(const SourceManager* sourceManager, uint32_t numThreads = 1);
 
 private:
-    flat_hash_map<std::tuple<DiagCode, SourceLocation>, std::vector<Diagnostic>> map;
+    using MapKey = std::tuple<DiagCode, SourceLocation>;
+    flat_hash_map<MapKey, std::vector<Diagnostic>> map;
 };
 
 } // namespace slang::ast
@@ -7,12 +7,15 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <functional>
+
 #include "slang/util/FlatMap.h"
 #include "slang/util/Util.h"
 
 namespace slang {
 
 class ConstantValue;
+class DocumentWriter;
 class JsonWriter;
 
 } // namespace slang
@@ -29,10 +32,15 @@ class Statement;
 class Symbol;
 class TimingControl;
 
-/// A class that serializes AST nodes to JSON.
+/// A class that serializes AST nodes to JSON, or to any other format
+/// supported by a DocumentWriter.
 class SLANG_EXPORT ASTSerializer {
 public:
     /// Constructs a new instance of the ASTSerializer class.
+    ASTSerializer(Compilation& compilation, DocumentWriter& writer);
+
+    /// Constructs a new instance of the ASTSerializer class that writes JSON.
+    /// Serializers constructed this way can use @a serializeInParallel.
     ASTSerializer(Compilation& compilation, JsonWriter& writer);
 
     Compilation& getCompilation() const { return compilation; }
@@ -54,9 +62,39 @@ public:
     /// been evaluated at least once.
     void setTryConstantFold(bool set) { tryConstantFold = set; }
 
+    /// A callback that can take over serialization of individual symbols.
+    /// If it returns true the serializer assumes that the callback has already
+    /// written the symbol's output (or deliberately written nothing) and skips it.
+    using SymbolOverride = std::function<bool(const Symbol&)>;
+
+    /// Sets a callback that is given a chance to write each symbol before it
+    /// is serialized. This is useful for splicing in output that was produced
+    /// ahead of time, such as by other serializers running in parallel.
+    void setSymbolOverride(SymbolOverride func) { symbolOverride = std::move(func); }
+
     /// Serializes a symbol to JSON.
     void serialize(const Symbol& symbol, bool inMembersArray = false);
 
+    /// @brief Serializes a symbol to JSON using multiple threads.
+    ///
+    /// Independent parts of the design underneath @a symbol (packages,
+    /// compilation units, and instance subtrees) are serialized concurrently
+    /// and written out in order as soon as each one is done, so the output is
+    /// byte-for-byte identical to that of @a serialize and only a few parts
+    /// are held in memory at any time.
+    ///
+    /// This requires the serializer to have been constructed with a JsonWriter
+    /// and the compilation to be frozen, since serializers on other threads will
+    /// be reading from it. Otherwise, or if constant folding or a symbol override
+    /// is enabled, this falls back to calling @a serialize.
+    ///
+    /// @param symbol The symbol to serialize.
+    /// @param numThreads The number of threads to use, or zero to use
+    ///                   the hardware concurrency.
+    /// @param inMembersArray Passed along to @a serialize.
+    void serializeInParallel(const Symbol& symbol, uint32_t numThreads = 0,
+                             bool inMembersArray = false);
+
     /// Serializes an expression to JSON.
     void serialize(const Expression& expr);
 
@@ -183,11 +221,13 @@ private:
     void visit(const T& symbol, bool inMembersArray = false);
 
     Compilation& compilation;
-    JsonWriter& writer;
+    DocumentWriter& writer;
+    JsonWriter* jsonWriter = nullptr;
     bool includeAddrs = true;
     bool includeSourceInfo = false;
     bool detailedTypeInfo = false;
     bool tryConstantFold = true;
+    SymbolOverride symbolOverride;
     flat_hash_set<const void*> visiting;
     flat_hash_set<const void*> printedEnums;
 };
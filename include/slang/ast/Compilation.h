@@ -177,6 +177,11 @@ struct SLANG_EXPORT CompilationOptions {
     /// source text is hopelessly broken.
     uint32_t typoCorrectionLimit = 32;
 
+    /// The number of threads to use for post-elaboration work that can be done
+    /// in parallel, such as coalescing diagnostics. Zero means use one thread
+    /// per hardware thread.
+    uint32_t numThreads = 1;
+
     /// Specifies which set of min:typ:max expressions should
     /// be used during compilation.
     MinTypMax minTypMax = MinTypMax::Typ;
@@ -660,6 +665,33 @@ public:
     /// Gets a scalar (single bit) type with the given flags.
     const Type& getScalarType(bitmask<IntegralFlags> flags) const;
 
+    /// Gets a packed array type with the given element type and range.
+    /// Array types are interned, so requesting the same element type and
+    /// dimension again returns the same type object.
+    /// @note @a width must be the element type's width times the range's width.
+    const Type& getPackedArrayType(const Type& elementType, ConstantRange range, bitwidth_t width);
+
+    /// Gets a fixed size unpacked array type with the given element type and range.
+    /// Array types are interned, so requesting the same element type and
+    /// dimension again returns the same type object.
+    /// @note the widths must be the element type's widths times the range's width.
+    const Type& getUnpackedArrayType(const Type& elementType, ConstantRange range,
+                                     uint64_t selectableWidth, uint64_t bitstreamWidth);
+
+    /// Gets a dynamic array type with the given element type. These are interned,
+    /// so requesting the same element type again returns the same type object.
+    const Type& getDynamicArrayType(const Type& elementType);
+
+    /// Gets an associative array type with the given element and index types (where
+    /// a null index type means a wildcard index). These are interned, so requesting
+    /// the same element and index types again returns the same type object.
+    const Type& getAssociativeArrayType(const Type& elementType, const Type* indexType);
+
+    /// Gets a queue type with the given element type and maximum bound. These are
+    /// interned, so requesting the same element type and bound again returns the
+    /// same type object.
+    const Type& getQueueType(const Type& elementType, uint32_t maxBound);
+
     /// Gets the nettype represented by the given token kind.
     /// If the token kind does not represent a nettype this will return the
     /// error nettype.
@@ -780,6 +812,8 @@ private:
         bool cannotCache = false;
     };
 
+    using ArrayTypeKey = std::tuple<SymbolKind, const Type*, const Type*, int32_t, int32_t>;
+
     bool doTypoCorrection() const { return typoCorrections < options.typoCorrectionLimit; }
     void didTypoCorrection() { typoCorrections++; }
 
@@ -810,6 +844,8 @@ private:
     std::pair<DefinitionLookupResult, bool> resolveConfigRules(
         std::string_view name, const Scope& scope, const ResolvedConfig* parentConfig,
         const ConfigRule* configRule, const std::vector<Symbol*>& defList) const;
+    template<typename T, typename... Args>
+    const Type& getArrayType(const ArrayTypeKey& key, Args&&... args);
     Diagnostic* errorMissingDef(std::string_view name, const Scope& scope, SourceRange sourceRange,
                                 DiagCode code) const;
 
@@ -855,6 +891,11 @@ private:
     // A cache of vector types, keyed on various properties such as bit width.
     flat_hash_map<uint32_t, const Type*> vectorTypeCache;
 
+    // A cache of array types, keyed on the kind of array, the element type,
+    // the associative index type (if any), and the range (or the queue's
+    // max bound in the first element of the range).
+    flat_hash_map<ArrayTypeKey, const Type*> arrayTypeCache;
+
     // Map from syntax kinds to the built-in types.
     flat_hash_map<syntax::SyntaxKind, const Type*> knownTypes;
 
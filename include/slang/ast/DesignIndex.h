@@ -0,0 +1,87 @@
+//------------------------------------------------------------------------------
+//! @file DesignIndex.h
+//! @brief Flat index of the nodes in an elaborated design, grouped by kind
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "slang/ast/Expression.h"
+#include "slang/ast/Statement.h"
+#include "slang/ast/Symbol.h"
+#include "slang/util/Enum.h"
+
+namespace slang::ast {
+
+class RootSymbol;
+
+/// Specifies which kinds of AST nodes are included in a DesignIndex.
+enum class SLANG_EXPORT DesignIndexFlags : uint8_t {
+    /// Only symbols are indexed.
+    None = 0,
+
+    /// Statements are indexed by kind in addition to symbols.
+    Statements = 1 << 0,
+
+    /// Expressions are indexed by kind in addition to symbols.
+    Expressions = 1 << 1
+};
+SLANG_BITMASK(DesignIndexFlags, Expressions)
+
+/// @brief An index of all of the nodes in an elaborated design, grouped by kind.
+///
+/// The index is built with a single traversal of the design, after which queries
+/// such as "all procedural blocks" or "all instances" are simple iterations over
+/// a contiguous array instead of full walks of the AST.
+///
+/// Instances whose bodies were deduplicated during elaboration (see
+/// @a InstanceSymbol::getCanonicalBody) are themselves included in the index,
+/// but the contents of their bodies are only included once, via the canonical body.
+///
+/// The index should be built once the compilation has been fully elaborated
+/// (typically after it has been frozen); nodes created after that point will
+/// not be present. Once built, the index is immutable and safe to query from
+/// multiple threads.
+class SLANG_EXPORT DesignIndex {
+public:
+    /// Builds a new index by traversing the design rooted at @a root.
+    explicit DesignIndex(const RootSymbol& root,
+                         bitmask<DesignIndexFlags> flags = DesignIndexFlags::None);
+
+    /// Gets all indexed symbols of the given kind, in traversal order.
+    std::span<const Symbol* const> getSymbols(SymbolKind kind) const {
+        return symbols[size_t(kind)];
+    }
+
+    /// Gets all indexed statements of the given kind, in traversal order.
+    /// This is always empty unless the index was built with
+    /// @a DesignIndexFlags::Statements.
+    std::span<const Statement* const> getStatements(StatementKind kind) const {
+        return statements[size_t(kind)];
+    }
+
+    /// Gets all indexed expressions of the given kind, in traversal order.
+    /// This is always empty unless the index was built with
+    /// @a DesignIndexFlags::Expressions.
+    std::span<const Expression* const> getExpressions(ExpressionKind kind) const {
+        return expressions[size_t(kind)];
+    }
+
+    /// Gets the flags that were used to build the index.
+    bitmask<DesignIndexFlags> getFlags() const { return flags; }
+
+private:
+    template<bool, bool>
+    friend struct DesignIndexBuilder;
+
+    bitmask<DesignIndexFlags> flags;
+    std::vector<std::vector<const Symbol*>> symbols;
+    std::vector<std::vector<const Statement*>> statements;
+    std::vector<std::vector<const Expression*>> expressions;
+};
+
+} // namespace slang::ast
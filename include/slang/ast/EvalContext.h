@@ -63,6 +63,10 @@ public:
     /// Resets the evaluation context back to an initial constructed state.
     void reset();
 
+    /// Resets the count of evaluation steps taken so far, without
+    /// clearing any other state such as local variables.
+    void resetSteps() { steps = 0; }
+
     /// Creates storage for a local variable in the current frame.
     ConstantValue* createLocal(const ValueSymbol* symbol, ConstantValue value = nullptr);
 
@@ -7,6 +7,9 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <memory>
+#include <string>
+
 #include "slang/ast/Compilation.h"
 #include "slang/ast/EvalContext.h"
 #include "slang/syntax/SyntaxFwd.h"
@@ -19,13 +22,23 @@ namespace slang::ast {
 
 /// A helper class that allows evaluating arbitrary snippets of SystemVerilog
 /// source code and maintaining state across multiple eval calls.
+///
+/// A session either owns its own compilation or is attached to an existing one,
+/// in which case snippets are evaluated directly against that compilation's
+/// symbols. Expressions that are evaluated via @a eval are cached by their text,
+/// so evaluating the same expression repeatedly (e.g. from a long-lived server)
+/// only pays for parsing and binding it once.
 class SLANG_EXPORT ScriptSession {
+    // Declared first so that it's constructed before the references below.
+    std::unique_ptr<Compilation> ownedCompilation;
+
 public:
     /// A bag of options to apply to the various evaluated snippets.
     Bag options;
 
-    /// A compilation object that holds state across evaluation calls.
-    Compilation compilation;
+    /// The compilation that holds state across evaluation calls. This is either
+    /// owned by the session or is the compilation that the session is attached to.
+    Compilation& compilation;
 
     /// A compilation unit that acts as a scope for evaluation.
     CompilationUnitSymbol& scope;
@@ -33,6 +46,22 @@ public:
     /// Constructs a new ScriptSession.
     explicit ScriptSession(Bag options = {});
 
+    /// Constructs a new ScriptSession that is attached to an existing compilation,
+    /// without copying anything out of it. Expressions are looked up as if they
+    /// appeared at the end of @a lookupScope, if provided, which allows for example
+    /// evaluating expressions in terms of the parameters of some instance.
+    /// Otherwise lookups happen from a new script scope added to the compilation.
+    /// Declarations are always added to that script scope.
+    ///
+    /// Binding expressions allocates from the compilation, so it must outlive
+    /// the session and must not be frozen.
+    ///
+    /// The session's @a options are seeded from the compilation's options. Unlike
+    /// an owned compilation, an attached one is not changed to allow hierarchical
+    /// names in constant expressions; create it with
+    /// @a CompilationFlags::AllowHierarchicalConst to evaluate names like `top.inst.D`.
+    explicit ScriptSession(Compilation& compilation, const Scope* lookupScope = nullptr);
+
     /// Tries to evaluate the given snippet of SystemVerilog code
     /// and returns the result as a constant value.
     ConstantValue eval(std::string_view text);
@@ -52,7 +81,11 @@ public:
     Diagnostics getDiagnostics();
 
 private:
+    const Expression& bindExpression(const syntax::ExpressionSyntax& expr);
+
     std::vector<std::shared_ptr<syntax::SyntaxTree>> syntaxTrees;
+    flat_hash_map<std::string, const Expression*> expressionCache;
+    const Scope& lookupScope;
     ASTContext astCtx;
     EvalContext evalContext;
 };
@@ -148,6 +148,10 @@ public:
         /// The maximum number of lexer errors that can be encountered before giving up.
         std::optional<uint32_t> maxLexerErrors;
 
+        /// If true, whitespace and comment trivia is not retained in syntax trees,
+        /// to reduce memory usage.
+        std::optional<bool> compactTrivia;
+
         /// The number of threads to use for parsing.
         std::optional<uint32_t> numThreads;
 
@@ -367,6 +371,33 @@ public:
     [[nodiscard]] bool runPreprocessor(bool includeComments, bool includeDirectives,
                                        bool obfuscateIds, bool useFixedObfuscationSeed = false);
 
+    /// @brief Runs the preprocessor on each compilation unit independently and
+    /// writes out the results as each one finishes.
+    ///
+    /// Loaded buffers are grouped into units the same way they would be for parsing,
+    /// so each file is its own unit unless single-unit mode is enabled, and library
+    /// files and separate units inherit macros following the same rules.
+    /// Units are preprocessed in parallel unless threading has been disabled
+    /// or identifiers are being obfuscated.
+    ///
+    /// Any errors encountered will be printed to stderr, and the output of units
+    /// that had errors will be omitted.
+    /// @param outputDir If set, the output of each unit is written to its own file in
+    ///                  this directory, named after the unit's first source file.
+    ///                  Otherwise the output of all units is printed to stdout in order.
+    /// @param includeComments If true, comments will be included in the output.
+    /// @param includeDirectives If true, preprocessor directives will be included in the output.
+    /// @param obfuscateIds If true, identifiers will be obfuscated by replacing them with
+    ///                     randomized alphanumeric strings.
+    /// @param useFixedObfuscationSeed If true, obfuscated identifiers will be generated with
+    ///                                a fixed randomization seed, meaning they will be the
+    ///                                same every time the program is run. Used for testing.
+    /// @returns true on success and false if errors were encountered.
+    [[nodiscard]] bool runPreprocessorPerUnit(const std::optional<std::string>& outputDir,
+                                              bool includeComments, bool includeDirectives,
+                                              bool obfuscateIds,
+                                              bool useFixedObfuscationSeed = false);
+
     /// Prints all macros from all loaded buffers to stdout.
     void reportMacros();
 
@@ -20,6 +20,7 @@
 #include "slang/text/Glob.h"
 #include "slang/text/SourceLocation.h"
 #include "slang/util/FlatMap.h"
+#include "slang/util/Function.h"
 #include "slang/util/Util.h"
 
 namespace slang {
@@ -145,10 +146,40 @@ public:
     /// Returns the source paths that have been loaded.
     std::vector<std::filesystem::path> getFilePaths() const;
 
+    /// A group of source buffers that are preprocessed together, as they
+    /// would be when parsed into a single syntax tree.
+    struct SourceUnit {
+        /// The buffers that make up the unit, in order.
+        std::vector<SourceBuffer> buffers;
+
+        /// Additional macro definitions that apply only to this unit.
+        std::span<const std::string> defines;
+
+        /// Additional include paths that apply only to this unit.
+        std::span<const std::filesystem::path> includePaths;
+
+        /// Set to true if the unit is made up of library files.
+        bool isLibrary = false;
+
+        /// Set to true if this is the unit formed from all directly specified
+        /// files in single-unit mode. There is at most one such unit.
+        bool isSingleUnit = false;
+
+        /// Set to true if the unit starts with all of the macros defined
+        /// by the single unit, if there is one.
+        bool inheritsMacros = false;
+    };
+
     /// Loads all of the sources that have been added to the loader,
     /// but does not parse them. Returns the loaded buffers.
     std::vector<SourceBuffer> loadSources();
 
+    /// Loads all of the sources that have been added to the loader and groups
+    /// them into the same units that @a loadAndParseSources would parse them as,
+    /// but does not parse them. Units are returned in the order in which their
+    /// first file was added to the loader.
+    std::vector<SourceUnit> loadSourceUnits(const Bag& optionBag);
+
     /// Loads and parses all of the source files that have been added to the loader.
     SyntaxTreeList loadAndParseSources(const Bag& optionBag);
 
@@ -159,59 +190,24 @@ public:
     /// it does not exist. Returns nullptr if @a name is empty.
     SourceLibrary* getOrAddLibrary(std::string_view name);
 
-    /// Load trees using a custom buffer finder function (templated with concept constraint)
+    /// Load trees using a custom buffer finder function (templated with concept constraint).
+    ///
+    /// Missing names are resolved in waves: all names missing after the previous wave
+    /// are located via @a findBufferFunc (in sorted order, on the calling thread) and
+    /// the resulting buffers are then parsed in parallel using up to @a numThreads
+    /// threads, or the hardware concurrency if not specified.
     template<BufferFinder FindBufferFunc>
     static void loadTrees(
         SyntaxTreeList& syntaxTrees, FindBufferFunc findBufferFunc, SourceManager& sourceManager,
         const Bag& optionBag = {},
-        std::span<const syntax::DefineDirectiveSyntax* const> inheritedMacros = {}) {
-        // If library directories are specified, see if we have any unknown instantiations
-        // or package names for which we should search for additional source files to load.
-        flat_hash_set<std::string_view> knownNames;
-        auto addKnownNames = [&](const std::shared_ptr<syntax::SyntaxTree>& tree) {
-            auto& meta = tree->getMetadata();
-            meta.visitDeclaredSymbols([&](std::string_view name) { knownNames.emplace(name); });
-        };
-
-        auto findMissingNames = [&](const std::shared_ptr<syntax::SyntaxTree>& tree,
-                                    flat_hash_set<std::string_view>& missing) {
-            auto& meta = tree->getMetadata();
-            meta.visitReferencedSymbols([&](std::string_view name) {
-                if (knownNames.find(name) == knownNames.end())
-                    missing.emplace(name);
-            });
-        };
-
-        for (auto& tree : syntaxTrees)
-            addKnownNames(tree);
-
-        flat_hash_set<std::string_view> missingNames;
-        for (auto& tree : syntaxTrees)
-            findMissingNames(tree, missingNames);
-
-        // Keep loading new files as long as we are making forward progress.
-        flat_hash_set<std::string_view> nextMissingNames;
-        while (true) {
-            for (auto name : missingNames) {
-                auto buffer = findBufferFunc(name);
-
-                if (buffer) {
-                    auto tree = syntax::SyntaxTree::fromBuffer(buffer, sourceManager, optionBag,
-                                                               inheritedMacros);
-                    tree->isLibraryUnit = true;
-                    syntaxTrees.emplace_back(tree);
-
-                    addKnownNames(tree);
-                    findMissingNames(tree, nextMissingNames);
-                }
-            }
-
-            if (nextMissingNames.empty())
-                break;
-
-            missingNames = std::move(nextMissingNames);
-            nextMissingNames = {};
-        }
+        std::span<const syntax::DefineDirectiveSyntax* const> inheritedMacros = {},
+        std::optional<uint32_t> numThreads = {}) {
+        loadTreesImpl(
+            syntaxTrees,
+            [&findBufferFunc](std::string_view name) -> SourceBuffer {
+                return findBufferFunc(name);
+            },
+            sourceManager, optionBag, inheritedMacros, numThreads);
     }
 
 private:
@@ -288,6 +284,16 @@ private:
                             const SourceOptions& srcOptions, uint64_t fileSortKey = UINT64_MAX);
     void addError(const std::filesystem::path& path, std::error_code ec);
 
+    static void loadTreesImpl(SyntaxTreeList& syntaxTrees,
+                              function_ref<SourceBuffer(std::string_view)> findBufferFunc,
+                              SourceManager& sourceManager, const Bag& optionBag,
+                              std::span<const syntax::DefineDirectiveSyntax* const> inheritedMacros,
+                              std::optional<uint32_t> numThreads);
+
+    /// List the contents of each search directory so that findBuffer
+    /// can rule out candidate files without touching the filesystem.
+    void indexSearchDirectories(const SourceOptions& srcOptions);
+
     /// Find a source buffer by searching through directories and extensions
     SourceBuffer findBuffer(std::string_view name);
 
@@ -298,6 +304,7 @@ private:
     flat_hash_map<std::string, std::unique_ptr<SourceLibrary>> libraries;
     std::deque<UnitEntry> unitEntries;
     std::vector<std::filesystem::path> searchDirectories;
+    std::vector<flat_hash_set<std::string>> searchDirectoryIndex;
     std::vector<std::filesystem::path> searchExtensions;
     flat_hash_set<std::string_view> uniqueExtensions;
     std::vector<std::string> errors;
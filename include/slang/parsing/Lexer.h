@@ -77,6 +77,14 @@ struct SLANG_EXPORT LexerOptions {
     /// If true, the preprocessor will support legacy protected envelope directives,
     /// for compatibility with old Verilog tools.
     bool enableLegacyProtect = false;
+
+    /// If true, whitespace and comment trivia is not retained in lexed tokens.
+    /// Tokens preceded only by such trivia instead share a single placeholder
+    /// space or newline, which greatly reduces the memory held by syntax trees
+    /// at the cost of no longer being able to print back the original text.
+    /// Tokens that make up macro definitions and macro arguments always keep
+    /// their trivia, since it is observable via macro stringification.
+    bool compactTrivia = false;
 };
 
 /// Possible encodings for encrypted text used in a pragma protect region.
@@ -107,6 +115,11 @@ public:
     /// is on the same line as the previous token we've lexed.
     bool isNextTokenOnSameLine();
 
+    /// Sets whether subsequently lexed tokens keep all of their trivia even if
+    /// @a LexerOptions::compactTrivia is enabled. The preprocessor uses this for
+    /// macro text, whose exact whitespace can end up in stringified strings.
+    void setRetainTrivia(bool value) { retainTrivia = value; }
+
     /// Lexes a token that contains encoded text as part of a protected envelope.
     Token lexEncodedText(ProtectEncoding encoding, uint32_t expectedBytes, bool singleLine,
                          bool legacyProtectedMode);
@@ -164,6 +177,8 @@ private:
     template<typename... Args>
     Token create(TokenKind kind, Args&&... args);
 
+    std::span<Trivia const> copyTrivia();
+
     void addTrivia(TriviaKind kind);
     Diagnostic& addDiag(DiagCode code, size_t offset);
 
@@ -206,6 +221,9 @@ private:
     // the number of errors that have occurred while lexing the current buffer
     uint32_t errorCount = 0;
 
+    // overrides options.compactTrivia while lexing macro text
+    bool retainTrivia = false;
+
     // temporary storage for building arrays of trivia
     SmallVector<Trivia, 32> triviaBuffer;
 
@@ -293,6 +293,7 @@ private:
     syntax::PrimitiveInstantiationSyntax& parsePrimitiveInstantiation(AttrList attributes);
     syntax::CheckerInstantiationSyntax& parseCheckerInstantiation(AttrList attributes);
     syntax::PortConnectionSyntax& parsePortConnection();
+    syntax::PropertyExprSyntax* parseSimplePortExpr(TokenKind endKind);
     syntax::FunctionPortBaseSyntax& parseFunctionPort(bitmask<FunctionOptions> options);
     syntax::FunctionPortListSyntax* parseFunctionPortList(bitmask<FunctionOptions> options);
     syntax::FunctionPrototypeSyntax& parseFunctionPrototype(syntax::SyntaxKind parentKind, bitmask<FunctionOptions> options, bool* isConstructor = nullptr);
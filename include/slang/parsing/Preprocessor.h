@@ -35,6 +35,8 @@ struct IncludeDirectiveSyntax;
 
 namespace slang::parsing {
 
+class MacroEnvironment;
+
 /// Contains various options that can control preprocessing behavior.
 struct SLANG_EXPORT PreprocessorOptions {
     /// The maximum depth of the include stack; further attempts to include
@@ -60,6 +62,10 @@ struct SLANG_EXPORT PreprocessorOptions {
 
     /// A set of preprocessor directives to be ignored.
     flat_hash_set<std::string_view> ignoreDirectives;
+
+    /// An optional frozen set of macros to start from instead of the built-in
+    /// macros. If set, @a predefines and @a undefines are applied on top of it.
+    std::shared_ptr<const MacroEnvironment> macroEnvironment;
 };
 
 /// Metadata about an include directive that was invoked.
@@ -319,6 +325,8 @@ private:
     bool expandReplacementList(std::span<Token const>& tokens,
                                SmallSet<const syntax::DefineDirectiveSyntax*, 8>& alreadyExpanded);
     bool applyMacroOps(std::span<Token const> tokens, SmallVectorBase<Token>& dest);
+    void createBuiltInMacros();
+    void resetMacros(const MacroEnvironment* environment);
     void createBuiltInMacro(std::string_view name, int value, std::string_view valueStr = {});
     void splitTokens(Token sourceToken, size_t offset, SmallVectorBase<Token>& results);
     Token getLastConsumed() const { return lastConsumed; }
@@ -326,6 +334,10 @@ private:
     static bool isSameMacro(const syntax::DefineDirectiveSyntax& left,
                             const syntax::DefineDirectiveSyntax& right);
 
+    // Macro map helpers that account for the base environment, if any.
+    const MacroDef* lookupMacro(std::string_view name) const;
+    void removeMacro(std::string_view name);
+
     // functions to advance the underlying token stream
     Token peek();
     Token consume();
@@ -407,9 +419,14 @@ private:
     // keep track of nested processor branches (ifdef, ifndef, else, elsif, endif)
     SmallVector<BranchEntry, 2> branchStack;
 
-    // map from macro name to macro definition
+    // map from macro name to macro definition; if we have a base environment
+    // this is an overlay on top of it, with invalid entries marking names
+    // that have been undefined.
     flat_hash_map<std::string_view, MacroDef> macros;
 
+    // the frozen environment our macro map is layered on top of, if any
+    const MacroEnvironment* baseMacros = nullptr;
+
     // list of expanded macro tokens to drain before continuing with active lexer
     SmallVector<Token> expandedTokens;
     Token* currentMacroToken = nullptr;
@@ -467,6 +484,63 @@ private:
                   void (Preprocessor::*)(Token, const syntax::PragmaExpressionSyntax*,
                                          SmallVectorBase<Token>&)>
         pragmaProtectHandlers;
+
+    friend class MacroEnvironment;
+};
+
+/// An immutable snapshot of a set of macro definitions that can be shared
+/// by any number of preprocessors (even concurrently), set via the
+/// @a PreprocessorOptions::macroEnvironment option.
+///
+/// Building an environment preprocesses the predefines once up front, so
+/// that each new preprocessor can start from the result in constant time
+/// instead of re-lexing and re-parsing every definition. Macros defined or
+/// undefined by a preprocessor are kept in its own overlay and never
+/// modify the shared environment.
+class SLANG_EXPORT MacroEnvironment {
+public:
+    /// Creates a new environment containing the built-in macros (or the macros
+    /// from an existing environment set in @a options), followed by the predefines,
+    /// undefines, and @a inheritedMacros, applied in the same manner as they
+    /// would be for a newly constructed Preprocessor.
+    ///
+    /// Inherited macros are not part of what an `undefineall directive resets a
+    /// preprocessor back to, just like when they're passed to a Preprocessor directly.
+    ///
+    /// @note The environment keeps alive the environment it was built from, but
+    /// it's up to the caller to ensure @a inheritedMacros outlive it.
+    static std::shared_ptr<const MacroEnvironment> create(
+        SourceManager& sourceManager, const Bag& options = {},
+        std::span<const syntax::DefineDirectiveSyntax* const> inheritedMacros = {});
+
+    /// Checks whether the given macro is defined in the environment.
+    bool isDefined(std::string_view name) const;
+
+    /// Gets the number of macros defined in the environment.
+    size_t size() const { return macros.size(); }
+
+    /// Gets all macros that are defined in the environment, sorted by name.
+    std::vector<const syntax::DefineDirectiveSyntax*> getDefinedMacros() const;
+
+    /// Gets any diagnostics that were issued while parsing the predefined macros.
+    const Diagnostics& getDiagnostics() const { return diagnostics; }
+
+private:
+    friend class Preprocessor;
+
+    MacroEnvironment() = default;
+
+    BumpAllocator alloc;
+    Diagnostics diagnostics;
+    flat_hash_map<std::string_view, Preprocessor::MacroDef> macros;
+
+    // The environment we were built from, kept alive since we
+    // reference syntax nodes allocated within it.
+    std::shared_ptr<const MacroEnvironment> parent;
+
+    // If we contain inherited macros, the same environment without
+    // them, which is what `undefineall resets back to.
+    std::shared_ptr<const MacroEnvironment> withoutInherited;
 };
 
 } // namespace slang::parsing
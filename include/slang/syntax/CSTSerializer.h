@@ -21,7 +21,7 @@ SLANG_ENUM(CSTJsonMode, MODE)
 /// Converts concrete syntax trees to JSON format for debugging and analysis
 class SLANG_EXPORT CSTSerializer {
 public:
-    explicit CSTSerializer(JsonWriter& writer, CSTJsonMode mode = CSTJsonMode::Full);
+    explicit CSTSerializer(DocumentWriter& writer, CSTJsonMode mode = CSTJsonMode::Full);
 
     /// Serialize a syntax tree to JSON
     void serialize(const SyntaxTree& tree);
@@ -33,7 +33,7 @@ private:
     void visitToken(parsing::Token token);
     void writeTokenTrivia(parsing::Token token);
 
-    JsonWriter& writer;
+    DocumentWriter& writer;
     CSTJsonMode mode;
 };
 
@@ -7,6 +7,7 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <iosfwd>
 #include <string>
 
 #include "slang/parsing/Token.h"
@@ -22,11 +23,28 @@ class SyntaxTree;
 
 /// Provides support for printing tokens, trivia, or whole syntax trees
 /// back to source code.
+///
+/// By default the printed text is accumulated in memory and can be retrieved
+/// via @a str. Alternatively the printer can be given an output stream, in
+/// which case text is written out in fixed-size chunks as it is produced so
+/// that arbitrarily large trees (e.g. with all includes and macros expanded)
+/// can be printed with bounded memory.
 class SLANG_EXPORT SyntaxPrinter {
 public:
     SyntaxPrinter() = default;
     explicit SyntaxPrinter(const SourceManager& sourceManager);
 
+    /// Constructs a printer that streams its output to the given stream.
+    /// Call @a flush once printing is finished to write out any text
+    /// that is still buffered.
+    explicit SyntaxPrinter(std::ostream& stream);
+
+    /// Constructs a printer that streams its output to the given stream,
+    /// using @a sourceManager to decide which preprocessed text to print.
+    /// Call @a flush once printing is finished to write out any text
+    /// that is still buffered.
+    SyntaxPrinter(const SourceManager& sourceManager, std::ostream& stream);
+
     /// Append raw text to the buffer.
     /// @return a reference to this object, to allow chaining additional method calls.
     SyntaxPrinter& append(std::string_view text);
@@ -105,9 +123,24 @@ public:
         return *this;
     }
 
-    /// @return a copy of the internal text buffer.
+    /// Sets whether to emit `line directives whenever the printed text switches
+    /// from one source file to another (such as when expanding includes), so that
+    /// tools consuming the output can map it back to the original sources.
+    /// This has no effect unless the printer was given a source manager.
+    /// @return a reference to this object, to allow chaining additional method calls.
+    SyntaxPrinter& setEmitLineDirectives(bool emit) {
+        emitLineDirectives = emit;
+        return *this;
+    }
+
+    /// @return a copy of the internal text buffer. If the printer was constructed
+    /// with an output stream this only includes text that has not yet been
+    /// flushed to the stream.
     std::string str() const { return buffer; }
 
+    /// Writes any buffered output to the output stream, if there is one.
+    void flush();
+
     /// A helper method that assists in printing an entire syntax tree back to source
     /// text. A SyntaxPrinter with useful defaults is constructed, the tree is printed,
     /// and the resulting text is returned.
@@ -116,9 +149,14 @@ public:
 private:
     bool shouldPrint(const SyntaxNode& syntax) const;
     bool shouldPrint(SourceLocation loc) const;
+    void addLineDirective(parsing::Token token, size_t triviaStart);
+    void flushIfNeeded();
 
     std::string buffer;
     const SourceManager* sourceManager = nullptr;
+    std::ostream* stream = nullptr;
+    BufferID lastBuffer;
+    char lastFlushedChar = 0;
     bool includeTrivia = true;
     bool includeMissing = false;
     bool includeSkipped = false;
@@ -127,6 +165,7 @@ private:
     bool expandMacros = false;
     bool includeComments = true;
     bool squashNewlines = true;
+    bool emitLineDirectives = false;
 };
 
 } // namespace slang::syntax
@@ -0,0 +1,93 @@
+//------------------------------------------------------------------------------
+//! @file BinaryDocument.h
+//! @brief Compact binary encoding for structured (JSON-like) documents
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <iosfwd>
+#include <string>
+
+#include "slang/text/DocumentWriter.h"
+#include "slang/util/FlatMap.h"
+
+namespace slang {
+
+/// @brief Writes documents in a compact binary format.
+///
+/// This is a drop-in alternative to JsonWriter for large outputs (such as
+/// a serialized AST) that are meant to be consumed by other tools rather
+/// than read by humans. The encoding is a flat stream of events that
+/// mirrors the sequence of DocumentWriter calls that produced it:
+/// - The stream starts with the magic bytes "SLBD" followed by a version byte.
+/// - Each event is a one byte tag optionally followed by a payload.
+/// - Integers are LEB128 varints, with signed values zigzag encoded.
+///   Floating point values are 8 byte little endian IEEE doubles.
+/// - Property names and string values are references into a string table
+///   that is built up as the document is written: a reference of 0 is
+///   followed by a new string (varint length + bytes) that is assigned the
+///   next id, 1 is followed by a string that is not added to the table,
+///   and any other value refers to the previously seen string with id
+///   (value - 2). The table holds at most MaxStringTableSize strings; once
+///   it is full, strings that aren't already in it are written inline.
+///
+/// Output is buffered in small chunks and written to the provided stream as
+/// it is produced, so the full document is never held in memory.
+/// Use BinaryDocumentReader to decode the result.
+class SLANG_EXPORT BinaryDocumentWriter final : public DocumentWriter {
+public:
+    /// The version of the binary format written by this class.
+    static constexpr uint8_t Version = 1;
+
+    /// The maximum number of strings the writer will add to its string table,
+    /// which bounds the memory used by both the writer and the reader.
+    static constexpr size_t MaxStringTableSize = 1 << 16;
+
+    /// Constructs a new writer that writes to the given stream.
+    explicit BinaryDocumentWriter(std::ostream& stream);
+
+    /// Flushes any remaining output to the stream.
+    ~BinaryDocumentWriter() override;
+
+    void startObject() override;
+    void endObject() override;
+    void startArray() override;
+    void endArray() override;
+    void writeProperty(std::string_view name) override;
+    void writeValue(std::string_view value) override;
+    void writeValue(int64_t value) override;
+    void writeValue(uint64_t value) override;
+    void writeValue(double value) override;
+    void writeValue(bool value) override;
+
+    using DocumentWriter::writeValue;
+
+    /// Writes any buffered output to the underlying stream.
+    void flush();
+
+private:
+    void writeTag(uint8_t tag);
+    void writeVarint(uint64_t value);
+    void writeString(std::string_view str);
+
+    std::ostream& stream;
+    std::string buffer;
+    flat_hash_map<std::string, uint64_t> stringTable;
+};
+
+/// Reads documents written by BinaryDocumentWriter.
+class SLANG_EXPORT BinaryDocumentReader {
+public:
+    /// Decodes the given binary document and replays its contents, in order,
+    /// into the provided @a writer. For example, passing a JsonWriter converts
+    /// the document to JSON text.
+    ///
+    /// @returns true on success, or false if the data is not a well-formed
+    /// binary document (in which case @a writer may have received a partial
+    /// sequence of events).
+    static bool read(std::string_view data, DocumentWriter& writer);
+};
+
+} // namespace slang
@@ -0,0 +1,65 @@
+//------------------------------------------------------------------------------
+//! @file DocumentWriter.h
+//! @brief Interface for writers of structured (JSON-like) documents
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include "slang/util/Util.h"
+
+namespace slang {
+
+/// An abstract writer of structured documents made up of objects, arrays,
+/// and scalar values, in the same shape as JSON.
+///
+/// Serializers (such as the AST and CST serializers) emit their output
+/// through this interface so that the same stream of events can be
+/// rendered as JSON text or in other formats.
+class SLANG_EXPORT DocumentWriter {
+public:
+    virtual ~DocumentWriter() = default;
+
+    /// Begins a new object. It's expected that you will write zero or
+    /// more properties and then end the object.
+    virtual void startObject() = 0;
+
+    /// Ends the currently active object.
+    virtual void endObject() = 0;
+
+    /// Begins a new array. It's expected that you will write zero or
+    /// more values and then end the array.
+    virtual void startArray() = 0;
+
+    /// Ends the currently active array.
+    virtual void endArray() = 0;
+
+    /// Writes an object property with the given name. It's expected that you
+    /// will immediately write some kind of value for the property.
+    virtual void writeProperty(std::string_view name) = 0;
+
+    /// Writes an array or property string value.
+    virtual void writeValue(std::string_view value) = 0;
+
+    /// Writes an array or property signed integer value.
+    virtual void writeValue(int64_t value) = 0;
+
+    /// Writes an array or property unsigned integer value.
+    virtual void writeValue(uint64_t value) = 0;
+
+    /// Writes an array or property floating point value.
+    virtual void writeValue(double value) = 0;
+
+    /// Writes an array or property boolean value.
+    virtual void writeValue(bool value) = 0;
+
+    // Don't let c-strings implicitly convert to bool, we want callers
+    // to pass a string_view instead.
+    void writeValue(const char*) = delete;
+};
+
+} // namespace slang
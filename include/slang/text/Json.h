@@ -7,9 +7,10 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <iosfwd>
 #include <memory>
 
-#include "slang/util/Util.h"
+#include "slang/text/DocumentWriter.h"
 
 namespace slang {
 
@@ -20,76 +21,108 @@ class FormatBuffer;
 /// This class is simple and has few features; it's expected that you'll
 /// call its methods in the correct order to generate valid JSON. If not,
 /// it will happily spit out unparseable text.
-class SLANG_EXPORT JsonWriter {
+///
+/// By default the emitted text is accumulated in memory and can be retrieved
+/// via @a view. Alternatively the writer can be given an output stream, in
+/// which case text is written out in fixed-size chunks as it is produced so
+/// that arbitrarily large documents can be emitted with bounded memory.
+class SLANG_EXPORT JsonWriter final : public DocumentWriter {
 public:
+    /// Constructs a writer that accumulates its output in memory.
     JsonWriter();
-    ~JsonWriter();
+
+    /// Constructs a writer that streams its output to the given stream.
+    /// Any remaining buffered output is written when the writer is
+    /// destroyed, but callers should prefer calling @a flush explicitly
+    /// so that stream errors can be reported.
+    explicit JsonWriter(std::ostream& stream);
+
+    ~JsonWriter() override;
 
     /// Sets the number of spaces to indent whenever opening a new
     /// level of structure in the JSON.
     void setIndentSize(int size) { indentSize = size; }
 
+    /// Gets the number of spaces to indent for each level of structure.
+    int getIndentSize() const { return indentSize; }
+
     /// Set whether pretty printing is enabled (off by default).
     /// When pretty printing is on, newlines, additional whitespace,
     /// and indentation are added to make the output more human friendly.
     void setPrettyPrint(bool enabled) { pretty = enabled; }
 
+    /// Gets whether pretty printing is enabled.
+    bool getPrettyPrint() const { return pretty; }
+
     /// @return a view of the emitted JSON text so far.
     /// @note the returned view is not guaranteed to remain valid once
-    /// additional writes are performed.
+    /// additional writes are performed. If the writer was constructed
+    /// with an output stream this only includes text that has not yet
+    /// been flushed to the stream.
     std::string_view view() const;
 
+    /// Writes any buffered output to the output stream, if there is one.
+    void flush();
+
     /// Begins a new JSON object. It's expected that you will write zero or
     /// more properties and then end the object.
-    void startObject();
+    void startObject() override;
 
     /// Ends the currently active object. Output will be messed up
     /// if there is no active object.
-    void endObject();
+    void endObject() override;
 
     /// Begins a new JSON array. It's expected that you will write zero or
     /// more values and then end the array.
-    void startArray();
+    void startArray() override;
 
     /// Ends the currently active array. Output will be messed up
     /// if there is no active object.
-    void endArray();
+    void endArray() override;
 
     /// Writes an object property with the given name. It's expected that you
     /// will immediately write some kind of value for the property.
-    void writeProperty(std::string_view name);
+    void writeProperty(std::string_view name) override;
 
     /// Writes an array or property string value.
-    void writeValue(std::string_view value);
+    void writeValue(std::string_view value) override;
 
     /// Writes an array or property signed integer value.
-    void writeValue(int64_t value);
+    void writeValue(int64_t value) override;
 
     /// Writes an array or property unsigned integer value.
-    void writeValue(uint64_t value);
+    void writeValue(uint64_t value) override;
 
     /// Writes an array or property floating point value.
-    void writeValue(double value);
+    void writeValue(double value) override;
 
     /// Writes an array or property boolean value ("true" or "false").
-    void writeValue(bool value);
+    void writeValue(bool value) override;
+
+    /// Writes an array or property value that has already been rendered to
+    /// JSON text, such as by another JsonWriter with the same formatting
+    /// options. When pretty printing, the text is re-indented to match the
+    /// current nesting level.
+    void writeRawValue(std::string_view json);
 
     /// Writes a newline character into the buffer.
     void writeNewLine();
 
-    // Don't let c-strings implicitly convert to bool, we want callers
-    // to pass a string_view instead.
-    void writeValue(const char*) = delete;
+    using DocumentWriter::writeValue;
 
 private:
+    void startValue();
     void endValue();
-    size_t findLastComma() const;
     void writeQuoted(std::string_view str);
 
     std::unique_ptr<FormatBuffer> buffer;
+    std::ostream* stream = nullptr;
 
     int currentIndent = 0;
     int indentSize = 2;
+    int depth = 0;
+    bool needComma = false;
+    bool afterProperty = false;
     bool pretty = false;
 };
 
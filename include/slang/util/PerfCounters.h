@@ -0,0 +1,72 @@
+//------------------------------------------------------------------------------
+//! @file PerfCounters.h
+//! @brief Lightweight counters for profiling hot paths
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <iosfwd>
+
+#include "slang/util/Enum.h"
+
+namespace slang {
+
+// clang-format off
+#define PC(x) \
+    x(Lookups) \
+    x(ConstantEvalSteps) \
+    x(MacroExpansions) \
+    x(InstanceCacheHits) \
+    x(InstanceCacheMisses) \
+    x(AllocatorSegments)
+SLANG_ENUM(PerfCounter, PC)
+#undef PC
+// clang-format on
+
+/// Support for counting how often various hot paths in the compiler are hit.
+///
+/// Counters are always compiled in but are disabled by default, in which case
+/// the cost of an @a increment call is a single branch. Once enabled, each thread
+/// increments its own private set of counters, so no synchronization is needed
+/// on the hot path; @a snapshot sums the values across all threads.
+class SLANG_EXPORT PerfCounters {
+public:
+    /// The values of all counters, indexed by PerfCounter.
+    using Values = std::array<uint64_t, PerfCounter_traits::values.size()>;
+
+    /// Indicates whether counting has been enabled or not.
+    static bool isEnabled() { return enabled; }
+
+    /// Enables or disables counting. This should be called before any
+    /// work that is meant to be counted is started.
+    static void setEnabled(bool value) { enabled = value; }
+
+    /// Adds @a amount to the given counter, if counting is enabled.
+    static void increment(PerfCounter counter, uint64_t amount = 1) {
+        if (enabled) [[unlikely]]
+            add(counter, amount);
+    }
+
+    /// Returns the current values of all counters, summed across all threads.
+    /// Counts from threads that are concurrently running may or may not
+    /// be included in the result.
+    static Values snapshot();
+
+    /// Resets all counters on all threads to zero.
+    static void reset();
+
+    /// Writes the current values of all counters to the given stream
+    /// as a human readable table.
+    static void writeTable(std::ostream& os);
+
+private:
+    static void add(PerfCounter counter, uint64_t amount);
+
+    static bool enabled;
+};
+
+} // namespace slang
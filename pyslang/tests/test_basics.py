@@ -1,6 +1,9 @@
 # SPDX-FileCopyrightText: Michael Popoloski
 # SPDX-License-Identifier: MIT
 
+import concurrent.futures
+import gc
+import weakref
 from pathlib import Path
 
 import pyslang
@@ -87,6 +90,37 @@ source:3:23: warning: arithmetic between operands of different types ('logic' an
     )
 
 
+def test_parallel_parsing_and_compilation(tmp_path):
+    paths = []
+    for i in range(8):
+        path = tmp_path / f"m{i}.sv"
+        path.write_text(f"module m{i}(input [{i}:0] a, output b); assign b = ^a; endmodule")
+        paths.append(str(path))
+
+    sm = pyslang.SourceManager()
+    trees = pyslang.SyntaxTree.fromFilesInParallel(paths, sm, numThreads=4)
+    assert len(trees) == len(paths)
+    for i, tree in enumerate(trees):
+        assert len(tree.diagnostics) == 0
+        assert tree.root.members[0].header.name.value == f"m{i}"
+
+    # The trees keep the source manager alive.
+    sm_ref = weakref.ref(sm)
+    del sm
+    gc.collect()
+    assert sm_ref() is not None
+
+    # Independent compilations can be elaborated concurrently
+    # since the GIL is released while they run.
+    def elaborate(tree):
+        comp = pyslang.Compilation()
+        comp.addSyntaxTree(tree)
+        return len(comp.getAllDiagnostics())
+
+    with concurrent.futures.ThreadPoolExecutor(max_workers=4) as executor:
+        assert list(executor.map(elaborate, trees)) == [0] * len(trees)
+
+
 def test_include_metadata():
     tree = pyslang.SyntaxTree.fromText(
         """
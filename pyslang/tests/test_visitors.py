@@ -119,3 +119,77 @@ endmodule
     v = Visitor()
     c.getRoot().visit(v.visit)
     assert v.statement_count == 11
+
+
+def test_ast_filtered_visit_and_collect():
+    """Test the natively filtered AST visit and collect methods."""
+
+    tree = pyslang.SyntaxTree.fromText(
+        """
+module leaf(input a, output b);
+    assign b = a;
+endmodule
+
+module top;
+    logic x, y, z;
+    leaf u1(.a(x), .b(y));
+    leaf u10(.a(y), .b(z));
+    initial x = 1;
+endmodule
+    """
+    )
+    c = pyslang.Compilation()
+    c.addSyntaxTree(tree)
+    root = c.getRoot()
+
+    insts = root.collect(symbolKinds=[pyslang.SymbolKind.Instance])
+    assert [i.hierarchicalPath for i in insts] == ["top", "top.u1", "top.u10"]
+
+    assigns = root.collect(symbolKinds=[pyslang.SymbolKind.ContinuousAssign])
+    assert len(assigns) == 2
+    assert all(isinstance(a, pyslang.ContinuousAssignSymbol) for a in assigns)
+
+    scoped = root.collect(
+        symbolKinds=[pyslang.SymbolKind.ContinuousAssign], scopePrefix="top.u1"
+    )
+    assert len(scoped) == 1
+
+    stmts = root.collect(statementKinds=[pyslang.StatementKind.ExpressionStatement])
+    assert len(stmts) == 1
+
+    visited = []
+
+    def handle(node):
+        visited.append(node.kind)
+        return pyslang.VisitAction.Interrupt
+
+    root.visit(
+        handle,
+        symbolKinds=[pyslang.SymbolKind.Instance],
+        expressionKinds=[pyslang.ExpressionKind.Assignment],
+    )
+    assert visited == [pyslang.SymbolKind.Instance]
+
+
+def test_syntax_filtered_visit_and_collect():
+    """Test the natively filtered syntax visit and collect methods."""
+
+    tree = pyslang.SyntaxTree.fromText(
+        """
+module m;
+    assign a = b;
+    assign c = d;
+endmodule
+    """
+    )
+
+    assigns = tree.root.collect(kinds=[pyslang.SyntaxKind.ContinuousAssign])
+    assert len(assigns) == 2
+    assert all(isinstance(a, pyslang.ContinuousAssignSyntax) for a in assigns)
+
+    names = []
+    tree.root.visit(
+        lambda node: names.append(node.identifier.valueText),
+        kinds=[pyslang.SyntaxKind.IdentifierName],
+    )
+    assert names == ["a", "b", "c", "d"]
@@ -9,6 +9,7 @@
 
 #include <fmt/core.h>
 
+#include "slang/analysis/AnalysisManager.h"
 #include "slang/analysis/CaseDecisionDag.h"
 #include "slang/diagnostics/AnalysisDiags.h"
 
@@ -162,10 +163,20 @@ bool FlowAnalysisBase::isFullyCovered(const CaseStatement& stmt, const Statement
         }
     }
 
-    std::optional<CaseDecisionDag> decisionDag;
+    // Small sets of clauses are cheap enough to analyze directly;
+    // larger ones go through the analysis manager's cache.
+    static constexpr size_t MinCachedClauses = 16;
+
+    std::shared_ptr<const CaseDecisionDag> decisionDag;
     auto makeDecisionDag = [&]() {
-        decisionDag.emplace(intVals, bitWidth, cond == CaseStatementCondition::WildcardXOrZ,
-                            options.maxCaseAnalysisSteps);
+        const bool wildcardX = cond == CaseStatementCondition::WildcardXOrZ;
+        if (analysisManager && intVals.size() >= MinCachedClauses) {
+            decisionDag = analysisManager->getCaseDecisionDag(intVals, bitWidth, wildcardX);
+        }
+        else {
+            decisionDag = std::make_shared<const CaseDecisionDag>(intVals, bitWidth, wildcardX,
+                                                                  options.maxCaseAnalysisSteps);
+        }
     };
 
     // If diagnostics are enabled do various lint checks now.
@@ -143,6 +143,38 @@ const AnalyzedProcedure* AnalysisManager::getAnalyzedSubroutine(
     return result;
 }
 
+std::shared_ptr<const CaseDecisionDag> AnalysisManager::getCaseDecisionDag(
+    std::span<const SVInt> clauses, uint32_t bitWidth, bool wildcardX) {
+
+    CaseDagKey key{{clauses.begin(), clauses.end()}, bitWidth, wildcardX};
+
+    std::shared_ptr<const CaseDecisionDag> result;
+    caseDags.cvisit(key, [&result](auto& item) { result = item.second; });
+    if (result)
+        return result;
+
+    // Another thread may race with us to build the same DAG; that's fine,
+    // the results are identical and whichever gets inserted first wins.
+    result = std::make_shared<const CaseDecisionDag>(clauses, bitWidth, wildcardX,
+                                                     options.maxCaseAnalysisSteps);
+    caseDags.emplace(std::move(key), result);
+    return result;
+}
+
+bool AnalysisManager::CaseDagKey::operator==(const CaseDagKey& other) const {
+    return bitWidth == other.bitWidth && wildcardX == other.wildcardX &&
+           std::ranges::equal(clauses, other.clauses,
+                              [](auto& l, auto& r) { return exactlyEqual(l, r); });
+}
+
+size_t AnalysisManager::CaseDagKeyHash::operator()(const CaseDagKey& key) const {
+    size_t h = 0;
+    hash_combine(h, key.bitWidth, key.wildcardX);
+    for (auto& clause : key.clauses)
+        hash_combine(h, clause.hash());
+    return h;
+}
+
 const AnalyzedProcedure* AnalysisManager::addAnalyzedSubroutine(
     const SubroutineSymbol& symbol, std::unique_ptr<AnalyzedProcedure> procedure) {
 
@@ -173,111 +205,144 @@ void AnalysisManager::noteDrivers(std::span<const SymbolDriverListPair> drivers)
     driverTracker.add(state.context, state.driverAlloc, drivers);
 }
 
-void AnalysisManager::getFunctionDrivers(const CallExpression& expr, const Symbol& containingSymbol,
-                                         SmallSet<const SubroutineSymbol*, 2>& visited,
-                                         std::vector<SymbolDriverListPair>& drivers) {
-    if (expr.isSystemCall() || expr.thisClass() ||
-        expr.getSubroutineKind() != SubroutineKind::Function) {
-        return;
-    }
+// Returns the subroutine invoked by the given call if its effects should be
+// propagated to the caller, or nullptr if not.
+static const SubroutineSymbol* getPropagatedCallee(const CallExpression& expr,
+                                                   SubroutineKind kind) {
+    if (expr.isSystemCall() || expr.getSubroutineKind() != kind)
+        return nullptr;
+
+    if (kind == SubroutineKind::Function && expr.thisClass())
+        return nullptr;
 
     auto& subroutine = *std::get<const SubroutineSymbol*>(expr.subroutine);
     if (subroutine.flags.has(MethodFlags::Pure | MethodFlags::InterfaceExtern |
                              MethodFlags::DPIImport | MethodFlags::Randomize |
                              MethodFlags::BuiltIn)) {
-        return;
+        return nullptr;
     }
 
     // The contents of non-static class methods don't get propagated up
     // to the caller.
-    auto subroutineParent = subroutine.getParentScope();
-    SLANG_ASSERT(subroutineParent);
-    if (subroutineParent->asSymbol().kind == SymbolKind::ClassType) {
-        if (!subroutine.flags.has(MethodFlags::Static))
-            return;
+    if (kind == SubroutineKind::Function) {
+        auto subroutineParent = subroutine.getParentScope();
+        SLANG_ASSERT(subroutineParent);
+        if (subroutineParent->asSymbol().kind == SymbolKind::ClassType &&
+            !subroutine.flags.has(MethodFlags::Static)) {
+            return nullptr;
+        }
     }
 
-    // If we've already visited this function then we don't need to
-    // analyze it again.
-    if (!visited.insert(&subroutine).second)
-        return;
+    return &subroutine;
+}
 
-    // Get analysis for the function.
-    auto& context = getState().context;
-    auto analysis = getAnalyzedSubroutine(subroutine);
+const AnalyzedProcedure& AnalysisManager::getOrAnalyzeSubroutine(const SubroutineSymbol& symbol) {
+    auto analysis = getAnalyzedSubroutine(symbol);
     if (!analysis) {
-        auto proc = std::make_unique<AnalyzedProcedure>(context, subroutine);
-        analysis = addAnalyzedSubroutine(subroutine, std::move(proc));
+        auto proc = std::make_unique<AnalyzedProcedure>(getState().context, symbol);
+        analysis = addAnalyzedSubroutine(symbol, std::move(proc));
     }
+    return *analysis;
+}
 
-    // For each driver in the function, create a new driver that points to the
-    // original driver but has the current procedure as the containing symbol.
-    auto funcDrivers = analysis->getDrivers();
-    drivers.reserve(drivers.size() + funcDrivers.size());
+void AnalysisManager::collectCallees(const SubroutineSymbol& symbol, const CallExpression* call,
+                                     SmallSet<const SubroutineSymbol*, 4>& visited,
+                                     std::vector<SubroutineSummary::Callee>& callees) {
+    if (!visited.insert(&symbol).second)
+        return;
 
-    for (auto& [valueSym, driverList] : funcDrivers) {
-        // The user can disable this inlining of drivers for function locals via a flag.
-        if (hasFlag(AnalysisFlags::AllowMultiDrivenLocals)) {
-            auto scope = valueSym->getParentScope();
-            while (scope && scope->asSymbol().kind == SymbolKind::StatementBlock)
-                scope = scope->asSymbol().getParentScope();
+    auto& analysis = getOrAnalyzeSubroutine(symbol);
+    callees.push_back({&symbol, &analysis, call});
 
-            if (scope == &subroutine)
-                continue;
-        }
+    // Functions propagate drivers from the functions they call, and tasks
+    // propagate timing controls from the tasks they call.
+    for (auto nested : analysis.getCallExpressions()) {
+        if (auto callee = getPropagatedCallee(*nested, symbol.subroutineKind))
+            collectCallees(*callee, nested, visited, callees);
+    }
+}
 
-        DriverList perSymbol;
-        for (auto& [driver, bounds] : driverList) {
-            auto newDriver = context.alloc.emplace<ValueDriver>(
-                driver->kind, *driver->prefixExpression, containingSymbol, DriverFlags::None);
-            newDriver->procCallExpression = &expr;
+const AnalysisManager::SubroutineSummary& AnalysisManager::getSubroutineSummary(
+    const SubroutineSymbol& symbol) {
 
-            perSymbol.emplace_back(newDriver, bounds);
-        }
+    const SubroutineSummary* result = nullptr;
+    subroutineSummaries.cvisit(&symbol, [&result](auto& item) { result = item.second.get(); });
+    if (result)
+        return *result;
 
-        drivers.emplace_back(valueSym, std::move(perSymbol));
-    }
+    auto summary = std::make_unique<SubroutineSummary>();
+    SmallSet<const SubroutineSymbol*, 4> visited;
+    collectCallees(symbol, nullptr, visited, summary->callees);
 
-    // If this function has any calls, we need to recursively add drivers
-    // from those calls as well.
-    for (auto call : analysis->getCallExpressions())
-        getFunctionDrivers(*call, containingSymbol, visited, drivers);
+    // Another thread may race with us to build the same summary;
+    // the results are identical so whichever gets inserted first wins.
+    auto updater = [&result](auto& item) { result = item.second.get(); };
+    subroutineSummaries.try_emplace_and_cvisit(&symbol, std::move(summary), updater, updater);
+    return *result;
 }
 
-void AnalysisManager::getTaskTimingControls(const CallExpression& expr,
-                                            SmallSet<const SubroutineSymbol*, 2>& visited,
-                                            std::vector<const ast::Statement*>& controls) {
-    if (expr.getSubroutineKind() != SubroutineKind::Task || expr.isSystemCall()) {
+void AnalysisManager::getFunctionDrivers(const CallExpression& expr, const Symbol& containingSymbol,
+                                         SmallSet<const SubroutineSymbol*, 2>& visited,
+                                         std::vector<SymbolDriverListPair>& drivers) {
+    auto subroutine = getPropagatedCallee(expr, SubroutineKind::Function);
+    if (!subroutine)
         return;
-    }
 
-    auto& subroutine = *std::get<const SubroutineSymbol*>(expr.subroutine);
-    if (subroutine.flags.has(MethodFlags::Pure | MethodFlags::InterfaceExtern |
-                             MethodFlags::DPIImport | MethodFlags::Randomize |
-                             MethodFlags::BuiltIn)) {
-        return;
-    }
+    auto& context = getState().context;
+    for (auto& callee : getSubroutineSummary(*subroutine).callees) {
+        // If we've already visited this function then we don't need to
+        // add its drivers again. Note that everything it calls will also
+        // have already been visited in that case.
+        if (!visited.insert(callee.subroutine).second)
+            continue;
 
-    // If we've already visited this task then we don't need to
-    // analyze it again.
-    if (!visited.insert(&subroutine).second)
-        return;
+        // For each driver in the function, create a new driver that points to the
+        // original driver but has the current procedure as the containing symbol.
+        auto callExpr = callee.call ? callee.call : &expr;
+        auto funcDrivers = callee.analysis->getDrivers();
+        drivers.reserve(drivers.size() + funcDrivers.size());
+
+        for (auto& [valueSym, driverList] : funcDrivers) {
+            // The user can disable this inlining of drivers for function locals via a flag.
+            if (hasFlag(AnalysisFlags::AllowMultiDrivenLocals)) {
+                auto scope = valueSym->getParentScope();
+                while (scope && scope->asSymbol().kind == SymbolKind::StatementBlock)
+                    scope = scope->asSymbol().getParentScope();
+
+                if (scope == callee.subroutine.get())
+                    continue;
+            }
 
-    // Get analysis for the task.
-    auto analysis = getAnalyzedSubroutine(subroutine);
-    if (!analysis) {
-        auto proc = std::make_unique<AnalyzedProcedure>(getState().context, subroutine);
-        analysis = addAnalyzedSubroutine(subroutine, std::move(proc));
+            DriverList perSymbol;
+            for (auto& [driver, bounds] : driverList) {
+                auto newDriver = context.alloc.emplace<ValueDriver>(
+                    driver->kind, *driver->prefixExpression, containingSymbol, DriverFlags::None);
+                newDriver->procCallExpression = callExpr;
+
+                perSymbol.emplace_back(newDriver, bounds);
+            }
+
+            drivers.emplace_back(valueSym, std::move(perSymbol));
+        }
     }
+}
 
-    // Add timing controls from the task to our list.
-    auto taskTimingControls = analysis->getTimingControls();
-    controls.insert(controls.end(), taskTimingControls.begin(), taskTimingControls.end());
+void AnalysisManager::getTaskTimingControls(const CallExpression& expr,
+                                            SmallSet<const SubroutineSymbol*, 2>& visited,
+                                            std::vector<const ast::Statement*>& controls) {
+    auto subroutine = getPropagatedCallee(expr, SubroutineKind::Task);
+    if (!subroutine)
+        return;
 
-    // If this task has any calls, we need to recursively add timing controls
-    // from those calls as well.
-    for (auto call : analysis->getCallExpressions())
-        getTaskTimingControls(*call, visited, controls);
+    for (auto& callee : getSubroutineSummary(*subroutine).callees) {
+        // If we've already visited this task then we don't need to
+        // add its timing controls again.
+        if (!visited.insert(callee.subroutine).second)
+            continue;
+
+        auto taskTimingControls = callee.analysis->getTimingControls();
+        controls.insert(controls.end(), taskTimingControls.begin(), taskTimingControls.end());
+    }
 }
 
 DriverList AnalysisManager::getDrivers(const ValueSymbol& symbol) const {
@@ -295,7 +360,7 @@ Diagnostics AnalysisManager::getDiagnostics(const SourceManager* sourceManager)
         }
     }
 
-    return diagMap.coalesce(sourceManager);
+    return diagMap.coalesce(sourceManager, options.numThreads);
 }
 
 PendingAnalysis AnalysisManager::analyzeSymbol(const Symbol& symbol) {
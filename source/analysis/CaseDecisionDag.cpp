@@ -7,91 +7,159 @@
 //------------------------------------------------------------------------------
 #include "slang/analysis/CaseDecisionDag.h"
 
-#include <numeric>
+#include <algorithm>
+#include <bit>
+
+#include "slang/util/SmallVector.h"
 
 namespace slang::analysis {
 
+namespace {
+
+// A set of clause indices, stored as a bit vector so that the clauses that
+// remain active down each branch of the DAG can be computed a word at a time.
+using ClauseSet = std::vector<uint64_t>;
+
+constexpr uint32_t BitsPerWord = 64;
+
+} // namespace
+
 CaseDecisionDag::CaseDecisionDag(std::span<const SVInt> clauses, uint32_t bitWidth, bool wildcardX,
                                  uint32_t maxSteps) {
     SLANG_ASSERT(bitWidth > 0);
 
-    std::vector<ClauseIndex> initialIndices(clauses.size());
-    std::iota(initialIndices.begin(), initialIndices.end(), 0);
-
 #if defined(SLANG_DEBUG)
     for (auto& clause : clauses)
         SLANG_ASSERT(clause.getBitWidth() == bitWidth);
 #endif
 
+    // Build a matrix of which clauses can match a 0 or a 1 at each level of
+    // the DAG, where level 0 tests the most significant bit. Clauses with a
+    // wildcard bit match both; clauses with a non-wildcard X match neither.
+    const size_t numWords = (clauses.size() + BitsPerWord - 1) / BitsPerWord;
+    std::vector<ClauseSet> zeroMatches(bitWidth, ClauseSet(numWords));
+    std::vector<ClauseSet> oneMatches(bitWidth, ClauseSet(numWords));
+    for (size_t i = 0; i < clauses.size(); i++) {
+        const uint64_t bit = 1ull << (i % BitsPerWord);
+        const size_t word = i / BitsPerWord;
+        for (uint32_t level = 0; level < bitWidth; level++) {
+            const auto p = clauses[i][int32_t(bitWidth - level - 1)];
+            const bool wildcard = exactlyEqual(p, logic_t::z) ||
+                                  (wildcardX && exactlyEqual(p, logic_t::x));
+            if (wildcard || exactlyEqual(p, logic_t(0)))
+                zeroMatches[level][word] |= bit;
+            if (wildcard || exactlyEqual(p, logic_t(1)))
+                oneMatches[level][word] |= bit;
+        }
+    }
+
+    // For each level, find the clauses that test any bit at or below it.
+    // Once none of the active clauses do, every path further down the DAG
+    // ends at an identical leaf and we can jump straight to it.
+    std::vector<ClauseSet> testedBelow(bitWidth + 1, ClauseSet(numWords));
+    for (uint32_t level = bitWidth; level > 0; level--) {
+        for (size_t word = 0; word < numWords; word++) {
+            testedBelow[level - 1][word] = testedBelow[level][word] |
+                                           ~(zeroMatches[level - 1][word] &
+                                             oneMatches[level - 1][word]);
+        }
+    }
+
+    ClauseSet initialSet(numWords, ~0ull);
+    if (auto rem = clauses.size() % BitsPerWord)
+        initialSet.back() = (1ull << rem) - 1;
+
     struct StackFrame {
         uint32_t level;
         SVInt curPath;
-        std::vector<ClauseIndex> activeIndices;
+        ClauseSet activeSet;
     };
 
     std::vector<StackFrame> stack;
-    stack.emplace_back(0, SVInt(bitWidth, 0, false), std::move(initialIndices));
+    stack.emplace_back(0, SVInt(bitWidth, 0, false), std::move(initialSet));
 
-    using MemoKey = std::pair<uint32_t, std::vector<ClauseIndex>>;
+    using MemoKey = std::pair<uint32_t, ClauseSet>;
     flat_hash_set<MemoKey> visitedKeys;
     flat_hash_set<ClauseIndex> usedIndices;
     uint32_t steps = 0;
 
+    auto isEmpty = [](const ClauseSet& set) {
+        return std::ranges::all_of(set, [](uint64_t word) { return word == 0; });
+    };
+
     while (!stack.empty() && ++steps < maxSteps) {
         auto frame = std::move(stack.back());
         stack.pop_back();
 
+        if (isEmpty(frame.activeSet)) {
+            // No clauses cover any path below this point, so we have a
+            // counterexample; there's no need to walk down to the leaves.
+            if (!counterexample)
+                counterexample = frame.curPath.shl(bitWidth - frame.level);
+            continue;
+        }
+
+        auto& tested = testedBelow[frame.level];
+        bool anyTested = false;
+        for (size_t word = 0; word < numWords; word++)
+            anyTested |= (frame.activeSet[word] & tested[word]) != 0;
+
+        if (!anyTested)
+            frame.level = bitWidth;
+
+        const uint32_t level = frame.level;
+
         // Check whether we've already observed a substructure identical
         // to this one, and if so skip visiting it again.
-        const uint32_t level = frame.level;
-        auto [memoIt, inserted] = visitedKeys.emplace(level, std::move(frame.activeIndices));
+        auto [memoIt, inserted] = visitedKeys.emplace(level, std::move(frame.activeSet));
         if (!inserted)
             continue;
 
-        const auto& activeIndices = memoIt->second;
+        const auto& activeSet = memoIt->second;
         if (level == bitWidth) {
-            if (activeIndices.empty()) {
-                // No clauses cover this path, so we have a counterexample.
-                if (!counterexample)
-                    counterexample = frame.curPath;
-            }
-            else {
-                usedIndices.insert(activeIndices[0]);
-                for (size_t i = 0; i < activeIndices.size(); i++) {
-                    for (size_t j = i + 1; j < activeIndices.size(); j++)
-                        overlappingClauses.insert({activeIndices[i], activeIndices[j]});
+            SmallVector<ClauseIndex> activeIndices;
+            for (size_t word = 0; word < numWords; word++) {
+                for (auto bits = activeSet[word]; bits; bits &= bits - 1) {
+                    activeIndices.push_back(
+                        ClauseIndex(word * BitsPerWord + size_t(std::countr_zero(bits))));
                 }
             }
+
+            usedIndices.insert(activeIndices[0]);
+            for (size_t i = 0; i < activeIndices.size(); i++) {
+                for (size_t j = i + 1; j < activeIndices.size(); j++)
+                    overlappingClauses.insert({activeIndices[i], activeIndices[j]});
+            }
             continue;
         }
 
-        // Filter indices to only those that are active at this level given
-        // the next character of each clause.
-        std::vector<ClauseIndex> falseIndices, trueIndices;
-        for (auto index : activeIndices) {
-            const auto p = clauses[index][int32_t(bitWidth - level - 1)];
-            if (exactlyEqual(p, logic_t(0)))
-                falseIndices.push_back(index);
-            else if (exactlyEqual(p, logic_t(1)))
-                trueIndices.push_back(index);
-            else if (exactlyEqual(p, logic_t::z) || (wildcardX && exactlyEqual(p, logic_t::x))) {
-                // If we have a wildcard, we need to check both branches.
-                falseIndices.push_back(index);
-                trueIndices.push_back(index);
-            }
+        // Filter the active clauses down to those that match each
+        // value of the bit at this level.
+        ClauseSet falseSet(numWords), trueSet(numWords);
+        for (size_t word = 0; word < numWords; word++) {
+            falseSet[word] = activeSet[word] & zeroMatches[level][word];
+            trueSet[word] = activeSet[word] & oneMatches[level][word];
+        }
+
+        // If this bit doesn't distinguish between any of the active clauses
+        // then both subtrees are identical and we only need to visit one.
+        if (falseSet == trueSet) {
+            frame.curPath = frame.curPath.shl(1);
+            stack.emplace_back(level + 1, std::move(frame.curPath), std::move(falseSet));
+            continue;
         }
 
         // Push both sides of the tree at the next level onto the stack.
         // If we already have a counterexample don't bother manipulating
         // the current path any further.
         if (counterexample) {
-            stack.emplace_back(level + 1, SVInt::Zero, std::move(trueIndices));
-            stack.emplace_back(level + 1, SVInt::Zero, std::move(falseIndices));
+            stack.emplace_back(level + 1, SVInt::Zero, std::move(trueSet));
+            stack.emplace_back(level + 1, SVInt::Zero, std::move(falseSet));
         }
         else {
             frame.curPath = frame.curPath.shl(1);
-            stack.emplace_back(level + 1, frame.curPath | SVInt::One, std::move(trueIndices));
-            stack.emplace_back(level + 1, frame.curPath, std::move(falseIndices));
+            stack.emplace_back(level + 1, frame.curPath | SVInt::One, std::move(trueSet));
+            stack.emplace_back(level + 1, frame.curPath, std::move(falseSet));
         }
     }
 
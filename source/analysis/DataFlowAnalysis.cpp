@@ -19,6 +19,7 @@ DataFlowAnalysis::DataFlowAnalysis(AnalysisContext& context, const Symbol& symbo
                          reportDiags ? &context.diagnostics : nullptr),
     context(context), bitMapAllocator(context.alloc), lspMapAllocator(context.alloc),
     lspVisitor(*this) {
+    analysisManager = context.manager;
 }
 
 bool DataFlowAnalysis::isReferenced(const ValueSymbol& symbol, const Expression& lsp) const {
@@ -48,8 +49,10 @@ bool DataFlowAnalysis::isDefinitelyAssigned(const ValueSymbol& symbol) const {
     if (it == symbolToSlot.end())
         return false;
 
-    auto& assigned = getState().assigned;
-    return it->second < assigned.size() && !assigned[it->second].empty();
+    auto& state = getState();
+    auto index = it->second;
+    return state.isFullyAssigned(index) ||
+           (index < state.assigned.size() && !state.assigned[index].empty());
 }
 
 void DataFlowAnalysis::noteReference(const ValueSymbol& symbol, const Expression& lsp) {
@@ -72,15 +75,37 @@ void DataFlowAnalysis::noteReference(const ValueSymbol& symbol, const Expression
     if (isLValue) {
         auto [it, inserted] = symbolToSlot.try_emplace(&symbol, (uint32_t)lvalues.size());
         if (inserted) {
-            lvalues.emplace_back(symbol);
+            std::pair<uint64_t, uint64_t> wholeBounds{0, symbol.getType().getSelectableWidth() - 1};
+            lvalues.emplace_back(symbol, wholeBounds);
             SLANG_ASSERT(lvalues.size() == symbolToSlot.size());
         }
 
         auto index = it->second;
-        if (index >= currState.assigned.size())
-            currState.assigned.resize(index + 1);
-
-        currState.assigned[index].unionWith(*bounds, {}, bitMapAllocator);
+        if (!currState.isFullyAssigned(index)) {
+            // Assignments to the whole variable are tracked in the dense bit set;
+            // only partial assignments need an interval map.
+            auto& wholeBounds = lvalues[index].wholeBounds;
+            if (*bounds == wholeBounds) {
+                currState.setFullyAssigned(index);
+                if (index < currState.assigned.size())
+                    currState.assigned[index].clear(bitMapAllocator);
+            }
+            else {
+                if (index >= currState.assigned.size())
+                    currState.assigned.resize(index + 1);
+
+                auto& imap = currState.assigned[index];
+                imap.unionWith(*bounds, {}, bitMapAllocator);
+
+                // If the partial assignments have now covered the whole
+                // variable we can promote it to the dense representation.
+                if (auto first = imap.begin(); first != imap.end() &&
+                                               first.bounds() == wholeBounds) {
+                    currState.setFullyAssigned(index);
+                    imap.clear(bitMapAllocator);
+                }
+            }
+        }
 
         auto& lspMap = lvalues[index].assigned;
         for (auto lspIt = lspMap.find(*bounds); lspIt != lspMap.end();) {
@@ -223,13 +248,37 @@ void DataFlowAnalysis::handleTiming(const TimingControl& timing) {
 
 void DataFlowAnalysis::joinState(DataFlowState& result, const DataFlowState& other) {
     if (result.reachable == other.reachable) {
-        if (result.assigned.size() > other.assigned.size())
-            result.assigned.resize(other.assigned.size());
-
-        for (size_t i = 0; i < result.assigned.size(); i++) {
-            result.assigned[i] = result.assigned[i].intersection(other.assigned[i],
-                                                                 bitMapAllocator);
+        // A variable stays wholly assigned only if it's wholly assigned
+        // along both paths. Words missing from either side are all zeros.
+        auto& resultBits = result.fullyAssigned;
+        auto& otherBits = other.fullyAssigned;
+
+        // Slots that are whole on one side but partial on the other take
+        // the partial intervals, so handle them before the bits are merged.
+        auto numSlots = std::max(result.assigned.size(), other.assigned.size());
+        if (result.assigned.size() < numSlots)
+            result.assigned.resize(numSlots);
+
+        for (size_t i = 0; i < numSlots; i++) {
+            // If the other side is wholly assigned, the result's
+            // intervals (if any) are already the intersection.
+            if (other.isFullyAssigned(i))
+                continue;
+
+            auto& left = result.assigned[i];
+            if (i >= other.assigned.size())
+                left.clear(bitMapAllocator);
+            else if (result.isFullyAssigned(i))
+                left = other.assigned[i].clone(bitMapAllocator);
+            else
+                left = left.intersection(other.assigned[i], bitMapAllocator);
         }
+
+        if (resultBits.size() > otherBits.size())
+            resultBits.resize(otherBits.size());
+
+        for (size_t i = 0; i < resultBits.size(); i++)
+            resultBits[i] &= otherBits[i];
     }
     else if (!result.reachable) {
         result = copyState(other);
@@ -242,19 +291,43 @@ void DataFlowAnalysis::meetState(DataFlowState& result, const DataFlowState& oth
         return;
     }
 
-    // Union the assigned state across each variable.
+    // Variables wholly assigned on either side are wholly assigned after.
+    auto& resultBits = result.fullyAssigned;
+    auto& otherBits = other.fullyAssigned;
+    if (resultBits.size() < otherBits.size())
+        resultBits.resize(otherBits.size());
+
+    for (size_t i = 0; i < otherBits.size(); i++)
+        resultBits[i] |= otherBits[i];
+
+    // Union the partially assigned state across each remaining variable.
     if (result.assigned.size() < other.assigned.size())
         result.assigned.resize(other.assigned.size());
 
-    for (size_t i = 0; i < other.assigned.size(); i++) {
-        for (auto it = other.assigned[i].begin(); it != other.assigned[i].end(); ++it)
-            result.assigned[i].unionWith(it.bounds(), *it, bitMapAllocator);
+    for (size_t i = 0; i < result.assigned.size(); i++) {
+        auto& left = result.assigned[i];
+        if (result.isFullyAssigned(i)) {
+            left.clear(bitMapAllocator);
+            continue;
+        }
+
+        if (i < other.assigned.size()) {
+            for (auto it = other.assigned[i].begin(); it != other.assigned[i].end(); ++it)
+                left.unionWith(it.bounds(), *it, bitMapAllocator);
+        }
+
+        if (auto first = left.begin();
+            first != left.end() && first.bounds() == lvalues[i].wholeBounds) {
+            result.setFullyAssigned(i);
+            left.clear(bitMapAllocator);
+        }
     }
 }
 
 DataFlowState DataFlowAnalysis::copyState(const DataFlowState& source) {
     DataFlowState result;
     result.reachable = source.reachable;
+    result.fullyAssigned = source.fullyAssigned;
     result.assigned.reserve(source.assigned.size());
     for (size_t i = 0; i < source.assigned.size(); i++)
         result.assigned.emplace_back(source.assigned[i].clone(bitMapAllocator));
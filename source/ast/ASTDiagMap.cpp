@@ -13,8 +13,15 @@
 #include "slang/ast/symbols/MemberSymbols.h"
 #include "slang/diagnostics/StatementsDiags.h"
 
+#if defined(SLANG_USE_THREADS)
+#    include <BS_thread_pool.hpp>
+#endif
+
 namespace slang::ast {
 
+// The number of distinct diagnostics at which we bother to coalesce in parallel.
+static constexpr size_t MinEntriesForThreading = 1024;
+
 Diagnostic& ASTDiagMap::add(Diagnostic diag, bool& isNew) {
     auto [it, inserted] = map.try_emplace({diag.code, diag.location}, std::vector<Diagnostic>{});
     isNew = inserted;
@@ -22,101 +29,142 @@ Diagnostic& ASTDiagMap::add(Diagnostic diag, bool& isNew) {
     return it->second.back();
 }
 
-Diagnostics ASTDiagMap::coalesce(const SourceManager* sourceManager) {
-    Diagnostics results;
-    for (auto& [key, diagList] : map) {
-        // If the location is NoLocation, just issue each diagnostic.
-        if (std::get<1>(key) == SourceLocation::NoLocation) {
-            for (auto& diag : diagList)
-                results.emplace_back(diag);
-            continue;
-        }
+// Coalesces the diagnostics that were issued with the same code and location.
+static void coalesceEntry(DiagCode code, SourceLocation location,
+                          std::vector<Diagnostic>& diagList, Diagnostics& results) {
+    // If the location is NoLocation, just issue each diagnostic.
+    if (location == SourceLocation::NoLocation) {
+        for (auto& diag : diagList)
+            results.emplace_back(diag);
+        return;
+    }
 
-        // Try to find a diagnostic in an instance that isn't at the top-level
-        // (printing such a path seems silly).
-        const Diagnostic* found = nullptr;
-        const Symbol* inst = nullptr;
-        size_t count = 0;
-        bool differingArgs = false;
-        const bool checkDifferentArgs = !std::get<0>(key).coalesceWithDifferingArgs();
-
-        for (auto& diag : diagList) {
-            if (found && checkDifferentArgs && *found != diag) {
-                differingArgs = true;
-                break;
-            }
+    // Try to find a diagnostic in an instance that isn't at the top-level
+    // (printing such a path seems silly).
+    const Diagnostic* found = nullptr;
+    const Symbol* inst = nullptr;
+    size_t count = 0;
+    bool differingArgs = false;
+    const bool checkDifferentArgs = !code.coalesceWithDifferingArgs();
+
+    for (auto& diag : diagList) {
+        if (found && checkDifferentArgs && *found != diag) {
+            differingArgs = true;
+            break;
+        }
 
-            auto symbol = diag.symbol;
-            while (symbol && symbol->kind != SymbolKind::InstanceBody) {
-                const Scope* scope;
-                if (symbol->kind == SymbolKind::CheckerInstanceBody) {
-                    auto& checkerBody = symbol->as<CheckerInstanceBodySymbol>();
-                    SLANG_ASSERT(checkerBody.parentInstance);
-                    scope = checkerBody.parentInstance->getParentScope();
-
-                    // Add an expansion note to the diagnostic since
-                    // we won't have added it yet for the checker.
-                    if (!checkerBody.flags.has(InstanceFlags::Uninstantiated)) {
-                        diag.addNote(diag::NoteWhileExpanding, checkerBody.parentInstance->location)
-                            << "checker"sv << checkerBody.checker.name;
-                    }
-                }
-                else {
-                    scope = symbol->getParentScope();
+        auto symbol = diag.symbol;
+        while (symbol && symbol->kind != SymbolKind::InstanceBody) {
+            const Scope* scope;
+            if (symbol->kind == SymbolKind::CheckerInstanceBody) {
+                auto& checkerBody = symbol->as<CheckerInstanceBodySymbol>();
+                SLANG_ASSERT(checkerBody.parentInstance);
+                scope = checkerBody.parentInstance->getParentScope();
+
+                // Add an expansion note to the diagnostic since
+                // we won't have added it yet for the checker.
+                if (!checkerBody.flags.has(InstanceFlags::Uninstantiated)) {
+                    diag.addNote(diag::NoteWhileExpanding, checkerBody.parentInstance->location)
+                        << "checker"sv << checkerBody.checker.name;
                 }
-
-                symbol = scope ? &scope->asSymbol() : nullptr;
+            }
+            else {
+                scope = symbol->getParentScope();
             }
 
-            if (!symbol)
-                continue;
+            symbol = scope ? &scope->asSymbol() : nullptr;
+        }
 
-            auto parent = symbol->as<InstanceBodySymbol>().parentInstance;
-            SLANG_ASSERT(parent);
+        if (!symbol)
+            continue;
 
-            count++;
-            if (auto scope = parent->getParentScope()) {
-                auto& sym = scope->asSymbol();
-                if (sym.kind != SymbolKind::Root && sym.kind != SymbolKind::CompilationUnit) {
-                    found = &diag;
-                    inst = parent;
-                }
+        auto parent = symbol->as<InstanceBodySymbol>().parentInstance;
+        SLANG_ASSERT(parent);
+
+        count++;
+        if (auto scope = parent->getParentScope()) {
+            auto& sym = scope->asSymbol();
+            if (sym.kind != SymbolKind::Root && sym.kind != SymbolKind::CompilationUnit) {
+                found = &diag;
+                inst = parent;
             }
         }
+    }
 
-        if (!differingArgs && found &&
-            inst->as<InstanceSymbol>().getDefinition().getInstanceCount() > count) {
-            // The diagnostic is present only in some instances, so include the coalescing
-            // information to point the user towards the right ones.
-            Diagnostic diag = *found;
-            diag.symbol = inst;
-            diag.coalesceCount = count;
-            results.emplace_back(std::move(diag));
+    if (!differingArgs && found &&
+        inst->as<InstanceSymbol>().getDefinition().getInstanceCount() > count) {
+        // The diagnostic is present only in some instances, so include the coalescing
+        // information to point the user towards the right ones.
+        Diagnostic diag = *found;
+        diag.symbol = inst;
+        diag.coalesceCount = count;
+        results.emplace_back(std::move(diag));
+    }
+    else {
+        // Otherwise no coalescing. If we had differing arguments then set each
+        // diagnostic's coalesce count to 1 (as opposed to letting it stay nullopt)
+        // so that we get the instance path to it printed automatically.
+        auto it = diagList.begin();
+        SLANG_ASSERT(it != diagList.end());
+
+        {
+            Diagnostic d = *it;
+            if (differingArgs)
+                d.coalesceCount = 1;
+            results.emplace_back(std::move(d));
         }
-        else {
-            // Otherwise no coalescing. If we had differing arguments then set each
-            // diagnostic's coalesce count to 1 (as opposed to letting it stay nullopt)
-            // so that we get the instance path to it printed automatically.
-            auto it = diagList.begin();
-            SLANG_ASSERT(it != diagList.end());
-
-            {
+
+        if (!checkDifferentArgs)
+            return;
+
+        // Only copy diagnostics that differ from the last one we kept;
+        // widely instantiated modules can produce a huge number of duplicates.
+        for (++it; it != diagList.end(); ++it) {
+            if (*it != results.back()) {
                 Diagnostic d = *it;
                 if (differingArgs)
                     d.coalesceCount = 1;
                 results.emplace_back(std::move(d));
             }
+        }
+    }
+}
 
-            for (++it; it != diagList.end(); ++it) {
-                Diagnostic d = *it;
-                if (checkDifferentArgs && d != results.back()) {
-                    if (differingArgs)
-                        d.coalesceCount = 1;
-                    results.emplace_back(std::move(d));
-                }
+Diagnostics ASTDiagMap::coalesce(const SourceManager* sourceManager, uint32_t numThreads) {
+    Diagnostics results;
+
+#if defined(SLANG_USE_THREADS)
+    if (map.size() >= MinEntriesForThreading && numThreads != 1) {
+        // Each entry is independent of the others, so coalesce contiguous blocks
+        // of them in parallel and then concatenate the blocks in their original
+        // order so that the result is identical to doing it serially.
+        std::vector<std::pair<const MapKey*, std::vector<Diagnostic>*>> entries;
+        entries.reserve(map.size());
+        for (auto& [key, diagList] : map)
+            entries.emplace_back(&key, &diagList);
+
+        auto coalesceBlock = [&](size_t start, size_t end) {
+            Diagnostics blockResults;
+            for (size_t i = start; i < end; i++) {
+                auto& [code, location] = *entries[i].first;
+                coalesceEntry(code, location, *entries[i].second, blockResults);
             }
+            return blockResults;
+        };
+
+        BS::thread_pool<> threadPool(numThreads);
+        auto blocks = threadPool.submit_blocks(size_t(0), entries.size(), coalesceBlock).get();
+        for (auto& block : blocks) {
+            for (auto& diag : block)
+                results.emplace_back(std::move(diag));
         }
     }
+    else
+#endif
+    {
+        for (auto& [key, diagList] : map)
+            coalesceEntry(std::get<0>(key), std::get<1>(key), diagList, results);
+    }
 
     if (sourceManager)
         results.sort(*sourceManager);
@@ -16,17 +16,177 @@
 #include "slang/text/FormatBuffer.h"
 #include "slang/text/Json.h"
 #include "slang/text/SourceManager.h"
+#include "slang/util/ScopeGuard.h"
+
+#if defined(SLANG_USE_THREADS)
+#    include <BS_thread_pool.hpp>
+#    include <deque>
+#endif
 
 namespace slang::ast {
 
-ASTSerializer::ASTSerializer(Compilation& compilation, JsonWriter& writer) :
+ASTSerializer::ASTSerializer(Compilation& compilation, DocumentWriter& writer) :
     compilation(compilation), writer(writer) {
 }
 
+ASTSerializer::ASTSerializer(Compilation& compilation, JsonWriter& writer) :
+    compilation(compilation), writer(writer), jsonWriter(&writer) {
+}
+
 void ASTSerializer::serialize(const Symbol& symbol, bool inMembersArray) {
+    if (symbolOverride && symbolOverride(symbol))
+        return;
+
     symbol.visit(*this, inMembersArray);
 }
 
+#if defined(SLANG_USE_THREADS)
+static void collectChildInstances(const Scope& scope, std::vector<const Symbol*>& results) {
+    for (auto& member : scope.members()) {
+        switch (member.kind) {
+            case SymbolKind::Instance:
+                results.push_back(&member);
+                break;
+            case SymbolKind::InstanceArray:
+                collectChildInstances(member.as<InstanceArraySymbol>(), results);
+                break;
+            case SymbolKind::GenerateBlock:
+                if (!member.as<GenerateBlockSymbol>().isUninstantiated)
+                    collectChildInstances(member.as<GenerateBlockSymbol>(), results);
+                break;
+            case SymbolKind::GenerateBlockArray:
+                if (member.as<GenerateBlockArraySymbol>().valid)
+                    collectChildInstances(member.as<GenerateBlockArraySymbol>(), results);
+                break;
+            default:
+                break;
+        }
+    }
+}
+#endif
+
+void ASTSerializer::serializeInParallel(const Symbol& symbol, uint32_t numThreads,
+                                        bool inMembersArray) {
+#if defined(SLANG_USE_THREADS)
+    if (numThreads == 1 || !jsonWriter || !compilation.isFrozen() || tryConstantFold ||
+        symbolOverride) {
+        serialize(symbol, inMembersArray);
+        return;
+    }
+
+    // Start with the symbol (or the members of the root) and keep splitting
+    // instances into their child instances until there are enough pieces.
+    // Splitting replaces each instance with its children in member order,
+    // so the pieces stay in the order the traversal below will reach them.
+    // The split doesn't depend on the number of threads; neither does the output.
+    static constexpr size_t TargetPieces = 64;
+    std::vector<const Symbol*> pieces;
+    if (symbol.kind == SymbolKind::Root) {
+        for (auto& member : symbol.as<RootSymbol>().members())
+            pieces.push_back(&member);
+    }
+    else {
+        pieces.push_back(&symbol);
+    }
+
+    const bool cachingEnabled = !compilation.hasFlag(CompilationFlags::DisableInstanceCaching);
+    for (bool expanded = true; expanded && pieces.size() < TargetPieces;) {
+        expanded = false;
+        std::vector<const Symbol*> nextPieces;
+        for (auto piece : pieces) {
+            // Instances that link to a canonical body don't serialize their own
+            // body, and uninstantiated instances aren't serialized at all.
+            if (piece->kind == SymbolKind::Instance) {
+                auto& inst = piece->as<InstanceSymbol>();
+                if ((!cachingEnabled || !inst.getCanonicalBody()) &&
+                    !inst.body.flags.has(InstanceFlags::Uninstantiated)) {
+                    auto count = nextPieces.size();
+                    collectChildInstances(inst.body, nextPieces);
+                    if (nextPieces.size() != count) {
+                        expanded = true;
+                        continue;
+                    }
+                }
+            }
+            nextPieces.push_back(piece);
+        }
+        pieces = std::move(nextPieces);
+    }
+
+    if (pieces.size() < 2) {
+        serialize(symbol, inMembersArray);
+        return;
+    }
+
+    flat_hash_map<const Symbol*, size_t> pieceIndex;
+    for (size_t i = 0; i < pieces.size(); i++)
+        pieceIndex.emplace(pieces[i], i);
+
+    auto serializePiece = [this, pretty = jsonWriter->getPrettyPrint(),
+                           indentSize = jsonWriter->getIndentSize()](const Symbol& piece) {
+        JsonWriter pieceWriter;
+        pieceWriter.setPrettyPrint(pretty);
+        pieceWriter.setIndentSize(indentSize);
+
+        ASTSerializer serializer(compilation, pieceWriter);
+        serializer.includeAddrs = includeAddrs;
+        serializer.includeSourceInfo = includeSourceInfo;
+        serializer.detailedTypeInfo = detailedTypeInfo;
+        serializer.tryConstantFold = false;
+        serializer.serialize(piece, /* inMembersArray */ true);
+        return std::string(pieceWriter.view());
+    };
+
+    // Only keep a bounded number of pieces in flight; each time one gets
+    // written out another one is started.
+    BS::thread_pool<> threadPool(numThreads);
+    const size_t window = threadPool.get_thread_count() * 2;
+
+    std::deque<std::future<std::string>> inFlight;
+    size_t nextToSubmit = 0;
+    size_t nextToWrite = 0;
+    auto fillWindow = [&] {
+        while (nextToSubmit < pieces.size() && inFlight.size() < window) {
+            auto piece = pieces[nextToSubmit++];
+            inFlight.push_back(
+                threadPool.submit_task([&serializePiece, piece] { return serializePiece(*piece); }));
+        }
+    };
+    fillWindow();
+
+    symbolOverride = [&](const Symbol& sym) {
+        auto it = pieceIndex.find(&sym);
+        if (it == pieceIndex.end() || it->second < nextToWrite)
+            return false;
+
+        // Drop any pieces the traversal didn't reach; they got serialized
+        // inline as part of something else.
+        for (; nextToWrite < it->second; nextToWrite++) {
+            inFlight.front().wait();
+            inFlight.pop_front();
+            fillWindow();
+        }
+
+        auto text = inFlight.front().get();
+        inFlight.pop_front();
+        nextToWrite++;
+        fillWindow();
+
+        // Symbols that serialize to nothing (like uninstantiated
+        // instances) must not produce an empty value.
+        if (!text.empty())
+            jsonWriter->writeRawValue(text);
+        return true;
+    };
+
+    auto guard = ScopeGuard([this] { symbolOverride = nullptr; });
+    serialize(symbol, inMembersArray);
+#else
+    (void)numThreads;
+    serialize(symbol, inMembersArray);
+#endif
+}
+
 void ASTSerializer::serialize(const Expression& expr) {
     expr.visit(*this);
 }
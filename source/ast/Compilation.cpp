@@ -1640,7 +1640,7 @@ const Diagnostics& Compilation::getSemanticDiagnostics() {
     // Elaborate the design.
     elaborate();
 
-    cachedSemanticDiagnostics.emplace(diagMap.coalesce(sourceManager));
+    cachedSemanticDiagnostics.emplace(diagMap.coalesce(sourceManager, options.numThreads));
     return *cachedSemanticDiagnostics;
 }
 
@@ -1749,8 +1749,8 @@ const Type& Compilation::getType(bitwidth_t width, bitmask<IntegralFlags> flags)
 
     SLANG_ASSERT(!isFrozen());
 
-    auto type = emplace<PackedArrayType>(getScalarType(flags), ConstantRange{int32_t(width - 1), 0},
-                                         width);
+    auto type = &getPackedArrayType(getScalarType(flags), ConstantRange{int32_t(width - 1), 0},
+                                    width);
     vectorTypeCache.emplace_hint(it, key, type);
     return *type;
 }
@@ -1761,6 +1761,50 @@ const Type& Compilation::getScalarType(bitmask<IntegralFlags> flags) const {
     return *ptr;
 }
 
+template<typename T, typename... Args>
+const Type& Compilation::getArrayType(const ArrayTypeKey& key, Args&&... args) {
+    auto [it, inserted] = arrayTypeCache.try_emplace(key, nullptr);
+    if (inserted) {
+        SLANG_ASSERT(!isFrozen());
+        it->second = emplace<T>(std::forward<Args>(args)...);
+    }
+    return *it->second;
+}
+
+const Type& Compilation::getPackedArrayType(const Type& elementType, ConstantRange range,
+                                            bitwidth_t width) {
+    return getArrayType<PackedArrayType>({SymbolKind::PackedArrayType, &elementType, nullptr,
+                                          range.left, range.right},
+                                         elementType, range, width);
+}
+
+const Type& Compilation::getUnpackedArrayType(const Type& elementType, ConstantRange range,
+                                              uint64_t selectableWidth, uint64_t bitstreamWidth) {
+    return getArrayType<FixedSizeUnpackedArrayType>({SymbolKind::FixedSizeUnpackedArrayType,
+                                                     &elementType, nullptr, range.left,
+                                                     range.right},
+                                                    elementType, range, selectableWidth,
+                                                    bitstreamWidth);
+}
+
+const Type& Compilation::getDynamicArrayType(const Type& elementType) {
+    return getArrayType<DynamicArrayType>({SymbolKind::DynamicArrayType, &elementType, nullptr, 0,
+                                           0},
+                                          elementType);
+}
+
+const Type& Compilation::getAssociativeArrayType(const Type& elementType, const Type* indexType) {
+    return getArrayType<AssociativeArrayType>({SymbolKind::AssociativeArrayType, &elementType,
+                                               indexType, 0, 0},
+                                              elementType, indexType);
+}
+
+const Type& Compilation::getQueueType(const Type& elementType, uint32_t maxBound) {
+    return getArrayType<QueueType>({SymbolKind::QueueType, &elementType, nullptr,
+                                    int32_t(maxBound), 0},
+                                   elementType, maxBound);
+}
+
 const NetType& Compilation::getNetType(TokenKind kind) const {
     auto it = knownNetTypes.find(kind);
     return it == knownNetTypes.end() ? *knownNetTypes.find(TokenKind::Unknown)->second
@@ -0,0 +1,89 @@
+//------------------------------------------------------------------------------
+// DesignIndex.cpp
+// Flat index of the nodes in an elaborated design, grouped by kind
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/ast/DesignIndex.h"
+
+#include "slang/ast/ASTVisitor.h"
+
+namespace slang::ast {
+
+template<bool VisitStatements, bool VisitExpressions>
+struct DesignIndexBuilder
+    : public ASTVisitor<DesignIndexBuilder<VisitStatements, VisitExpressions>, VisitStatements,
+                        VisitExpressions> {
+    DesignIndex& index;
+
+    explicit DesignIndexBuilder(DesignIndex& index) : index(index) {}
+
+    template<std::derived_from<Symbol> T>
+    void handle(const T& symbol) {
+        // Deferred members and other placeholders are
+        // visited as a shared invalid symbol; skip those.
+        if (symbol.kind != SymbolKind::Unknown)
+            index.symbols[size_t(symbol.kind)].push_back(&symbol);
+        this->visitDefault(symbol);
+    }
+
+    void handle(const InstanceSymbol& symbol) {
+        index.symbols[size_t(symbol.kind)].push_back(&symbol);
+
+        // If this instance's body is a duplicate of one we've already
+        // seen, only index its port connections and not the body itself.
+        if (symbol.getCanonicalBody()) {
+            if constexpr (VisitExpressions)
+                symbol.visitExprs(*this);
+            return;
+        }
+        this->visitDefault(symbol);
+    }
+
+    template<std::derived_from<Statement> T>
+    void handle(const T& stmt) {
+        index.statements[size_t(stmt.kind)].push_back(&stmt);
+        this->visitDefault(stmt);
+    }
+
+    template<std::derived_from<Expression> T>
+    void handle(const T& expr) {
+        index.expressions[size_t(expr.kind)].push_back(&expr);
+        this->visitDefault(expr);
+    }
+};
+
+DesignIndex::DesignIndex(const RootSymbol& root, bitmask<DesignIndexFlags> flags) : flags(flags) {
+    symbols.resize(SymbolKind_traits::values.size());
+    statements.resize(StatementKind_traits::values.size());
+    expressions.resize(ExpressionKind_traits::values.size());
+
+    const bool stmts = flags.has(DesignIndexFlags::Statements);
+    const bool exprs = flags.has(DesignIndexFlags::Expressions);
+    if (stmts && exprs) {
+        DesignIndexBuilder<true, true> builder(*this);
+        root.visit(builder);
+    }
+    else if (stmts) {
+        DesignIndexBuilder<true, false> builder(*this);
+        root.visit(builder);
+    }
+    else if (exprs) {
+        DesignIndexBuilder<false, true> builder(*this);
+        root.visit(builder);
+    }
+    else {
+        DesignIndexBuilder<false, false> builder(*this);
+        root.visit(builder);
+    }
+
+    for (auto& list : symbols)
+        list.shrink_to_fit();
+    for (auto& list : statements)
+        list.shrink_to_fit();
+    for (auto& list : expressions)
+        list.shrink_to_fit();
+}
+
+} // namespace slang::ast
@@ -11,6 +11,7 @@
 #include "slang/ast/EvalContext.h"
 #include "slang/diagnostics/CompilationDiags.h"
 #include "slang/diagnostics/DeclarationsDiags.h"
+#include "slang/util/PerfCounters.h"
 #include "slang/util/TimeTrace.h"
 
 namespace slang::ast {
@@ -589,8 +590,10 @@ struct DiagnosticVisitor : public ASTVisitor<DiagnosticVisitor, false, false> {
             return false;
 
         auto [it, inserted] = instanceCache.try_emplace(std::move(key), symbol.body);
-        if (inserted)
+        if (inserted) {
+            PerfCounters::increment(PerfCounter::InstanceCacheMisses);
             return false;
+        }
 
         // If we haven't resolved the side effects entry yet do that now.
         // We do this opportunistically here because we know we have a cache hit.
@@ -617,6 +620,7 @@ struct DiagnosticVisitor : public ASTVisitor<DiagnosticVisitor, false, false> {
         // Assuming we find an appropriately cached instance, we will store a pointer to it
         // in other instances to facilitate downstream consumers in not needing to recreate
         // this duplication detection logic again.
+        PerfCounters::increment(PerfCounter::InstanceCacheHits);
         symbol.setCanonicalBody(entry.canonicalBody);
 
         // If this is an interface or an instance instantiated within an interface
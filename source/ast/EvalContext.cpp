@@ -14,6 +14,7 @@
 #include "slang/ast/types/Type.h"
 #include "slang/diagnostics/ConstEvalDiags.h"
 #include "slang/text/FormatBuffer.h"
+#include "slang/util/PerfCounters.h"
 
 namespace slang::ast {
 
@@ -107,6 +108,7 @@ LValue* EvalContext::getTopLValue() const {
 }
 
 bool EvalContext::step(SourceLocation loc) {
+    PerfCounters::increment(PerfCounter::ConstantEvalSteps);
     if (++steps < getCompilation().getOptions().maxConstexprSteps)
         return true;
 
@@ -29,6 +29,7 @@
 #include "slang/parsing/LexerFacts.h"
 #include "slang/syntax/AllSyntax.h"
 #include "slang/text/SourceManager.h"
+#include "slang/util/PerfCounters.h"
 #include "slang/util/String.h"
 
 namespace slang::ast {
@@ -1748,6 +1749,8 @@ void Lookup::unqualifiedImpl(const Scope& scope, std::string_view name, LookupLo
                              std::optional<SourceRange> sourceRange, bitmask<LookupFlags> flags,
                              SymbolIndex outOfBlockIndex, LookupResult& result,
                              const Scope& originalScope, const SyntaxNode* originalSyntax) {
+    PerfCounters::increment(PerfCounter::Lookups);
+
     auto reportRecursiveError = [&](const Symbol& symbol) {
         if (sourceRange) {
             auto& diag = result.addDiag(scope, diag::RecursiveDefinition, *sourceRange);
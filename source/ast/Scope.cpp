@@ -839,6 +839,7 @@ void Scope::elaborate() const {
     }
 
     SLANG_ASSERT(needsElaboration);
+    SLANG_ASSERT(!compilation.isFrozen());
     needsElaboration = false;
 
     if (isUncacheable)
@@ -14,27 +14,67 @@
 #include "slang/ast/symbols/BlockSymbols.h"
 #include "slang/ast/symbols/CompilationUnitSymbols.h"
 #include "slang/ast/symbols/VariableSymbols.h"
+#include "slang/parsing/Parser.h"
 #include "slang/syntax/AllSyntax.h"
 #include "slang/syntax/SyntaxTree.h"
 
 namespace slang::ast {
 
+using namespace parsing;
 using namespace syntax;
 
-static Bag& createOptions(Bag& options) {
+static Bag createOptions(Bag options) {
     auto& co = options.insertOrGet<CompilationOptions>();
     co.flags |= CompilationFlags::AllowHierarchicalConst;
     return options;
 }
 
+static Bag createOptions(const Compilation& compilation) {
+    // Snippets are parsed with the same options as the compilation they're
+    // attached to, so that e.g. the language version matches.
+    auto& co = compilation.getOptions();
+    Bag options;
+    options.set(co);
+
+    LexerOptions lo;
+    lo.languageVersion = co.languageVersion;
+    options.set(lo);
+
+    PreprocessorOptions ppo;
+    ppo.languageVersion = co.languageVersion;
+    options.set(ppo);
+
+    ParserOptions po;
+    po.languageVersion = co.languageVersion;
+    options.set(po);
+    return options;
+}
+
 ScriptSession::ScriptSession(Bag options) :
-    options(std::move(options)), compilation(createOptions(this->options)),
-    scope(compilation.createScriptScope()), astCtx(scope, LookupLocation::max),
+    ownedCompilation(std::make_unique<Compilation>(createOptions(options))),
+    options(createOptions(std::move(options))), compilation(*ownedCompilation),
+    scope(compilation.createScriptScope()), lookupScope(scope),
+    astCtx(scope, LookupLocation::max), evalContext(astCtx, EvalFlags::IsScript) {
+    evalContext.pushEmptyFrame();
+}
+
+ScriptSession::ScriptSession(Compilation& compilation, const Scope* lookupScope) :
+    options(createOptions(compilation)), compilation(compilation),
+    scope(compilation.createScriptScope()),
+    lookupScope(lookupScope ? *lookupScope : scope), astCtx(this->lookupScope, LookupLocation::max),
     evalContext(astCtx, EvalFlags::IsScript) {
     evalContext.pushEmptyFrame();
 }
 
 ConstantValue ScriptSession::eval(std::string_view text) {
+    // Each call gets its own budget of evaluation steps,
+    // no matter how long the session has been alive.
+    evalContext.resetSteps();
+
+    std::string key(text);
+    if (auto it = expressionCache.find(key); it != expressionCache.end())
+        return it->second->eval(evalContext);
+
     syntaxTrees.emplace_back(SyntaxTree::fromText(text, options));
 
     const auto& node = syntaxTrees.back()->root();
@@ -81,7 +121,14 @@ ConstantValue ScriptSession::eval(std::string_view text) {
             }
 
             if (ExpressionSyntax::isKind(node.kind)) {
-                return evalExpression(node.as<ExpressionSyntax>());
+                auto& bound = bindExpression(node.as<ExpressionSyntax>());
+
+                // Expressions that declare nothing can be reused as-is the next time
+                // we see the same text; they don't depend on anything but the scope.
+                if (!node.previewNode && !bound.bad() && syntaxTrees.back()->diagnostics().empty())
+                    expressionCache.emplace(std::move(key), &bound);
+
+                return bound.eval(evalContext);
             }
             else if (StatementSyntax::isKind(node.kind)) {
                 evalStatement(node.as<StatementSyntax>());
@@ -98,9 +145,12 @@ ConstantValue ScriptSession::eval(std::string_view text) {
 }
 
 ConstantValue ScriptSession::evalExpression(const ExpressionSyntax& expr) {
-    ASTContext context(scope, LookupLocation::max);
-    auto& bound = Expression::bind(expr, context, ASTFlags::AssignmentAllowed);
-    return bound.eval(evalContext);
+    return bindExpression(expr).eval(evalContext);
+}
+
+const Expression& ScriptSession::bindExpression(const ExpressionSyntax& expr) {
+    ASTContext context(lookupScope, LookupLocation::max);
+    return Expression::bind(expr, context, ASTFlags::AssignmentAllowed);
 }
 
 void ScriptSession::evalStatement(const StatementSyntax& stmt) {
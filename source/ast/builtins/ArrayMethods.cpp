@@ -274,12 +274,12 @@ public:
                     context.addDiag(diag::AssociativeWildcardNotAllowed, range) << name;
                     return comp.getErrorType();
                 }
-                return *comp.emplace<QueueType>(*indexType, 0u);
+                return comp.getQueueType(*indexType, 0u);
             }
-            return *comp.emplace<QueueType>(comp.getIntType(), 0u);
+            return comp.getQueueType(comp.getIntType(), 0u);
         }
 
-        return *comp.emplace<QueueType>(*arrayType->getArrayElementType(), 0u);
+        return comp.getQueueType(*arrayType->getArrayElementType(), 0u);
     }
 
     ConstantValue eval(EvalContext& context, const Args& args, SourceRange,
@@ -383,7 +383,7 @@ public:
             return comp.getErrorType();
         }
 
-        return *comp.emplace<QueueType>(*elemType, 0u);
+        return comp.getQueueType(*elemType, 0u);
     }
 
     ConstantValue eval(EvalContext& context, const Args& args, SourceRange,
@@ -469,12 +469,12 @@ public:
                     context.addDiag(diag::AssociativeWildcardNotAllowed, range) << name;
                     return comp.getErrorType();
                 }
-                return *comp.emplace<QueueType>(*indexType, 0u);
+                return comp.getQueueType(*indexType, 0u);
             }
-            return *comp.emplace<QueueType>(comp.getIntType(), 0u);
+            return comp.getQueueType(comp.getIntType(), 0u);
         }
 
-        return *comp.emplace<QueueType>(*arrayType->getArrayElementType(), 0u);
+        return comp.getQueueType(*arrayType->getArrayElementType(), 0u);
     }
 
     ConstantValue eval(EvalContext& context, const Args& args, SourceRange,
@@ -984,14 +984,14 @@ public:
                                                            iterExpr->sourceRange);
             }
             case SymbolKind::DynamicArrayType:
-                return *comp.emplace<DynamicArrayType>(elemType);
+                return comp.getDynamicArrayType(elemType);
             case SymbolKind::AssociativeArrayType: {
                 auto& aat = arrayType.as<AssociativeArrayType>();
-                return *comp.emplace<AssociativeArrayType>(elemType, aat.indexType);
+                return comp.getAssociativeArrayType(elemType, aat.indexType);
             }
             case SymbolKind::QueueType: {
                 auto& qt = arrayType.as<QueueType>();
-                return *comp.emplace<QueueType>(elemType, qt.maxBound);
+                return comp.getQueueType(elemType, qt.maxBound);
             }
             default:
                 SLANG_UNREACHABLE;
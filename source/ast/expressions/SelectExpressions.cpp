@@ -468,7 +468,7 @@ Expression& RangeSelectExpression::fromSyntax(Compilation& compilation, Expressi
 
     // If this is selecting from a queue, the result is always a queue.
     if (isQueue) {
-        result->type = compilation.emplace<QueueType>(elementType, 0u);
+        result->type = &compilation.getQueueType(elementType, 0u);
         return *result;
     }
 
@@ -478,7 +478,7 @@ Expression& RangeSelectExpression::fromSyntax(Compilation& compilation, Expressi
     if (context.flags.has(ASTFlags::StreamingWithRange)) {
         if (context.inUnevaluatedBranch() || !context.tryEval(right) ||
             (selectionKind == RangeSelectionKind::Simple && !context.tryEval(left))) {
-            result->type = compilation.emplace<QueueType>(elementType, 0u);
+            result->type = &compilation.getQueueType(elementType, 0u);
             return *result;
         }
     }
@@ -607,9 +607,9 @@ void CoverageBinSymbol::resolve() const {
     auto bindWithExpr = [&](const WithClauseSyntax& withSyntax) {
         // Create the iterator variable and set it up with an AST context so that it
         // can be found by the iteration expression.
-        auto arrayType = comp.emplace<DynamicArrayType>(type);
+        auto& arrayType = comp.getDynamicArrayType(type);
         auto it = comp.emplace<IteratorSymbol>(*context.scope, "item"sv, coverpoint.location,
-                                               *arrayType, ""sv);
+                                               arrayType, ""sv);
 
         ASTContext iterCtx = context;
         it->nextTemp = std::exchange(iterCtx.firstTempVar, it);
@@ -971,9 +971,9 @@ void CoverCrossSymbol::addBody(const syntax::CoverCrossSyntax& syntax, const Sco
     valType_t->targetType.setType(valType.type);
     body->addMember(*valType_t);
 
-    auto queueType = comp.emplace<QueueType>(*valType_t, 0u);
+    auto& queueType = comp.getQueueType(*valType_t, 0u);
     auto queueType_t = comp.emplace<TypeAliasType>("CrossQueueType", location);
-    queueType_t->targetType.setType(*queueType);
+    queueType_t->targetType.setType(queueType);
     body->addMember(*queueType_t);
     body->crossQueueType = queueType_t;
 
@@ -1192,9 +1192,9 @@ BinsSelectExpr& BinSelectWithFilterExpr::fromSyntax(const BinSelectWithFilterExp
 
     auto& cross = context.scope->asSymbol().getParentScope()->asSymbol().as<CoverCrossSymbol>();
     for (auto target : cross.targets) {
-        auto arrayType = comp.emplace<DynamicArrayType>(target->getType());
+        auto& arrayType = comp.getDynamicArrayType(target->getType());
         auto it = comp.emplace<IteratorSymbol>(*context.scope, target->name, target->location,
-                                               *arrayType, ""sv);
+                                               arrayType, ""sv);
         it->nextTemp = std::exchange(iterCtx.firstTempVar, it);
     }
 
@@ -694,11 +694,7 @@ const Type& PackedArrayType::fromDim(const Scope& scope, const Type& elementType
         return comp.getErrorType();
     }
 
-    auto result = comp.emplace<PackedArrayType>(elementType, dim, bitwidth_t(*width));
-    if (auto syntax = sourceRange.syntax())
-        result->setSyntax(*syntax);
-
-    return *result;
+    return comp.getPackedArrayType(elementType, dim, bitwidth_t(*width));
 }
 
 void PackedArrayType::serializeTo(ASTSerializer& serializer) const {
@@ -740,12 +736,7 @@ const Type& FixedSizeUnpackedArrayType::fromDim(const Scope& scope, const Type&
         return comp.getErrorType();
     }
 
-    auto result = comp.emplace<FixedSizeUnpackedArrayType>(elementType, dim, *selectableWidth,
-                                                           *bitstreamWidth);
-    if (auto syntax = sourceRange.syntax())
-        result->setSyntax(*syntax);
-
-    return *result;
+    return comp.getUnpackedArrayType(elementType, dim, *selectableWidth, *bitstreamWidth);
 }
 
 ConstantValue FixedSizeUnpackedArrayType::getDefaultValueImpl() const {
@@ -922,7 +922,7 @@ static const Type* changeSign(Compilation& compilation, const Type& type, bool s
     for (size_t i = 0; i < count; i++) {
         // There's no worry about size overflow here because we started with a valid type.
         ConstantRange dim = dims[count - i - 1];
-        curr = compilation.emplace<PackedArrayType>(*curr, dim, curr->getBitWidth() * dim.width());
+        curr = &compilation.getPackedArrayType(*curr, dim, curr->getBitWidth() * dim.width());
     }
 
     return curr;
@@ -1154,30 +1154,21 @@ const Type& Type::fromSyntax(Compilation& compilation, const Type& elementType,
                 result = &FixedSizeUnpackedArrayType::fromDim(*context.scope, *result, dim.range,
                                                               syntax);
                 break;
-            case DimensionKind::Dynamic: {
-                auto next = compilation.emplace<DynamicArrayType>(*result);
-                next->setSyntax(syntax);
-                result = next;
+            case DimensionKind::Dynamic:
+                result = &compilation.getDynamicArrayType(*result);
                 break;
-            }
             case DimensionKind::DPIOpenArray: {
                 auto next = compilation.emplace<DPIOpenArrayType>(*result, /* isPacked */ false);
                 next->setSyntax(syntax);
                 result = next;
                 break;
             }
-            case DimensionKind::Associative: {
-                auto next = compilation.emplace<AssociativeArrayType>(*result, dim.associativeType);
-                next->setSyntax(syntax);
-                result = next;
+            case DimensionKind::Associative:
+                result = &compilation.getAssociativeArrayType(*result, dim.associativeType);
                 break;
-            }
-            case DimensionKind::Queue: {
-                auto next = compilation.emplace<QueueType>(*result, dim.queueMaxSize);
-                next->setSyntax(syntax);
-                result = next;
+            case DimensionKind::Queue:
+                result = &compilation.getQueueType(*result, dim.queueMaxSize);
                 break;
-            }
         }
     }
 
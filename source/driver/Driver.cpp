@@ -8,7 +8,10 @@
 //------------------------------------------------------------------------------
 #include "slang/driver/Driver.h"
 
+#include <BS_thread_pool.hpp>
 #include <fmt/color.h>
+#include <fstream>
+#include <sstream>
 
 #include "slang/analysis/AnalysisManager.h"
 #include "slang/ast/SemanticFacts.h"
@@ -151,6 +154,8 @@ void Driver::addStandardArgs() {
                 "Maximum number of errors that can occur during lexing before the rest of the file "
                 "is skipped",
                 "<count>");
+    cmdLine.add("--compact-trivia", options.compactTrivia,
+                "Discard whitespace and comments from parsed syntax trees to reduce memory usage");
 #if defined(SLANG_USE_THREADS)
     cmdLine.add("-j,--threads", options.numThreads,
                 "The number of threads to use to parallelize parsing", "<count>");
@@ -698,6 +703,45 @@ static std::string generateRandomAlphaString(TGenerator& gen, size_t len) {
     return result;
 }
 
+// Pulls all tokens out of the given preprocessor and prints them to @a output.
+// If @a rng is set, identifiers are replaced by random strings, recorded in
+// @a obfuscationMap so that each name is always given the same replacement.
+static void printPreprocessedTokens(Preprocessor& preprocessor, SyntaxPrinter& output,
+                                    BumpAllocator& alloc, std::optional<std::mt19937>& rng,
+                                    flat_hash_map<std::string, std::string>& obfuscationMap) {
+    while (true) {
+        Token token = preprocessor.next();
+        if (token.kind == TokenKind::IntegerBase) {
+            // This is needed for the case where obfuscation is enabled,
+            // the digits of a vector literal may be lexed initially as
+            // an identifier and we don't have the parser here to fix things
+            // up for us.
+            do {
+                output.print(token);
+                token = preprocessor.next();
+            } while (SyntaxFacts::isPossibleVectorDigit(token.kind));
+        }
+
+        if (rng && token.kind == TokenKind::Identifier) {
+            auto name = std::string(token.valueText());
+            auto translation = obfuscationMap.find(name);
+            if (translation == obfuscationMap.end()) {
+                auto newName = generateRandomAlphaString(*rng, 16);
+                translation = obfuscationMap.emplace(name, newName).first;
+            }
+            token = token.withRawText(alloc, translation->second);
+        }
+
+        output.print(token);
+        if (token.kind == TokenKind::EndOfFile)
+            break;
+    }
+}
+
+static bool hasErrors(const Diagnostics& diagnostics) {
+    return std::ranges::any_of(diagnostics, [](const Diagnostic& diag) { return diag.isError(); });
+}
+
 bool Driver::runPreprocessor(bool includeComments, bool includeDirectives, bool obfuscateIds,
                              bool useFixedObfuscationSeed) {
     BumpAllocator alloc;
@@ -722,44 +766,228 @@ bool Driver::runPreprocessor(bool includeComments, bool includeDirectives, bool
             rng = createRandomGenerator<std::mt19937>();
     }
 
-    while (true) {
-        Token token = preprocessor.next();
-        if (token.kind == TokenKind::IntegerBase) {
-            // This is needed for the case where obfuscation is enabled,
-            // the digits of a vector literal may be lexed initially as
-            // an identifier and we don't have the parser here to fix things
-            // up for us.
-            do {
-                output.print(token);
-                token = preprocessor.next();
-            } while (SyntaxFacts::isPossibleVectorDigit(token.kind));
+    printPreprocessedTokens(preprocessor, output, alloc, rng, obfuscationMap);
+
+    // Only print diagnostics if actual errors occurred.
+    if (hasErrors(diagnostics)) {
+        OS::printE(fmt::format("{}", DiagnosticEngine::reportAll(sourceManager, diagnostics)));
+        return false;
+    }
+
+    OS::print(fmt::format("{}\n", output.str()));
+    return true;
+}
+
+bool Driver::runPreprocessorPerUnit(const std::optional<std::string>& outputDir,
+                                    bool includeComments, bool includeDirectives,
+                                    bool obfuscateIds, bool useFixedObfuscationSeed) {
+    auto optionBag = createParseOptionBag();
+    auto units = sourceLoader.loadSourceUnits(optionBag);
+    if (!reportLoadErrors())
+        return false;
+
+    // Parse the predefined macros once up front into a shared environment,
+    // the same way the SourceLoader does when parsing.
+    auto& ppOptions = optionBag.insertOrGet<PreprocessorOptions>();
+    ppOptions.macroEnvironment = MacroEnvironment::create(sourceManager, optionBag);
+    ppOptions.predefines.clear();
+
+    std::optional<std::mt19937> rng;
+    flat_hash_map<std::string, std::string> obfuscationMap;
+
+    if (obfuscateIds) {
+        if (useFixedObfuscationSeed)
+            rng.emplace();
+        else
+            rng = createRandomGenerator<std::mt19937>();
+    }
+
+    // Choose output file names up front so that they don't depend on the order
+    // in which units finish. Units are named after their first file.
+    std::vector<fs::path> outputPaths;
+    if (outputDir) {
+        std::error_code ec;
+        fs::create_directories(*outputDir, ec);
+        if (ec) {
+            printError(fmt::format("unable to create directory '{}': {}", *outputDir,
+                                   ec.message()));
+            return false;
         }
 
-        if (obfuscateIds && token.kind == TokenKind::Identifier) {
-            auto name = std::string(token.valueText());
-            auto translation = obfuscationMap.find(name);
-            if (translation == obfuscationMap.end()) {
-                auto newName = generateRandomAlphaString(*rng, 16);
-                translation = obfuscationMap.emplace(name, newName).first;
+        flat_hash_set<fs::path> usedNames;
+        for (size_t i = 0; i < units.size(); i++) {
+            auto fileName = fs::path(sourceManager.getRawFileName(units[i].buffers[0].id))
+                                .filename();
+            if (fileName.empty())
+                fileName = fmt::format("unit{}.sv", i);
+
+            auto name = fileName;
+            for (size_t n = 1; !usedNames.emplace(name).second; n++) {
+                name = fileName.stem();
+                name += fmt::format("_{}", n);
+                name += fileName.extension();
             }
-            token = token.withRawText(alloc, translation->second);
+
+            outputPaths.emplace_back(fs::path(*outputDir) / name);
         }
+    }
 
-        output.print(token);
-        if (token.kind == TokenKind::EndOfFile)
-            break;
+    std::optional<size_t> singleUnitIndex;
+    for (size_t i = 0; i < units.size(); i++) {
+        if (units[i].isSingleUnit)
+            singleUnitIndex = i;
     }
 
-    // Only print diagnostics if actual errors occurred.
-    for (auto& diag : diagnostics) {
-        if (diag.isError()) {
-            OS::printE(fmt::format("{}", DiagnosticEngine::reportAll(sourceManager, diagnostics)));
+    // Units that inherit macros can't start until the single unit is done.
+    auto waitsForSingleUnit = [&](size_t index) {
+        return singleUnitIndex && units[index].inheritsMacros;
+    };
+
+    struct UnitResult {
+        std::string text;
+        Diagnostics diagnostics;
+        bool writeFailed = false;
+    };
+
+    // The single unit's macros are allocated from its own allocator,
+    // which is kept alive so that other units can inherit them.
+    BumpAllocator singleUnitAlloc;
+    std::vector<const DefineDirectiveSyntax*> inheritedMacros;
+
+    auto preprocessUnit = [&](size_t index) {
+        auto& unit = units[index];
+        auto unitOptions = optionBag;
+        auto& unitPPOptions = unitOptions.insertOrGet<PreprocessorOptions>();
+        unitPPOptions.predefines.insert(unitPPOptions.predefines.end(), unit.defines.begin(),
+                                        unit.defines.end());
+        unitPPOptions.additionalIncludePaths.insert(unitPPOptions.additionalIncludePaths.end(),
+                                                    unit.includePaths.begin(),
+                                                    unit.includePaths.end());
+
+        BumpAllocator localAlloc;
+        auto& alloc = unit.isSingleUnit ? singleUnitAlloc : localAlloc;
+
+        UnitResult result;
+        Preprocessor preprocessor(sourceManager, alloc, result.diagnostics, unitOptions,
+                                  unit.inheritsMacros
+                                      ? std::span<const DefineDirectiveSyntax* const>(
+                                            inheritedMacros)
+                                      : std::span<const DefineDirectiveSyntax* const>());
+
+        for (auto it = unit.buffers.rbegin(); it != unit.buffers.rend(); it++)
+            preprocessor.pushSource(*it);
+
+        // Output files are streamed to directly; output for stdout is held
+        // until the unit is done so that it can be dropped if errors occur.
+        std::ofstream file;
+        std::ostringstream text;
+        std::ostream* stream = &text;
+        if (outputDir) {
+            file.open(outputPaths[index]);
+            if (file)
+                stream = &file;
+            else
+                result.writeFailed = true;
+        }
+
+        SyntaxPrinter output(*stream);
+        output.setIncludeComments(includeComments);
+        output.setIncludeDirectives(includeDirectives);
+        printPreprocessedTokens(preprocessor, output, alloc, rng, obfuscationMap);
+        output.flush();
+        *stream << '\n';
+
+        if (unit.isSingleUnit)
+            inheritedMacros = preprocessor.getDefinedMacros();
+
+        if (file.is_open()) {
+            file.close();
+            if (!file)
+                result.writeFailed = true;
+        }
+
+        if (!outputDir)
+            result.text = std::move(text).str();
+        return result;
+    };
+
+    // Reports the result of a unit; this is always called in unit order.
+    auto emitUnit = [&](size_t index, UnitResult&& result) {
+        if (result.writeFailed) {
+            printError(fmt::format("unable to write output file '{}'",
+                                   outputPaths[index].string()));
+            return false;
+        }
+
+        // Only print diagnostics if actual errors occurred.
+        if (hasErrors(result.diagnostics)) {
+            OS::printE(fmt::format("{}", DiagnosticEngine::reportAll(sourceManager,
+                                                                     result.diagnostics)));
+            if (outputDir) {
+                std::error_code ec;
+                fs::remove(outputPaths[index], ec);
+            }
             return false;
         }
+
+        if (!outputDir)
+            OS::print(result.text);
+        return true;
+    };
+
+    bool ok = true;
+
+    // Obfuscation shares one map (and one random sequence) across all units,
+    // so it always runs serially to keep the results deterministic.
+    if (units.size() >= SourceLoader::MinFilesForThreading && options.numThreads != 1u &&
+        !obfuscateIds) {
+        BS::thread_pool<> threadPool(options.numThreads.value_or(0u));
+
+        std::vector<std::future<UnitResult>> futures(units.size());
+        for (size_t i = 0; i < units.size(); i++) {
+            if (!waitsForSingleUnit(i))
+                futures[i] = threadPool.submit_task([&preprocessUnit, i] {
+                    return preprocessUnit(i);
+                });
+        }
+
+        if (singleUnitIndex) {
+            futures[*singleUnitIndex].wait();
+            for (size_t i = 0; i < units.size(); i++) {
+                if (waitsForSingleUnit(i))
+                    futures[i] = threadPool.submit_task([&preprocessUnit, i] {
+                        return preprocessUnit(i);
+                    });
+            }
+        }
+
+        // Results are emitted in order as they become available, so at most
+        // the units that finish ahead of the next one are held in memory.
+        for (size_t i = 0; i < units.size(); i++)
+            ok &= emitUnit(i, futures[i].get());
+    }
+    else {
+        // If any unit that comes before the single unit wants to inherit
+        // its macros, the single unit has to be preprocessed first.
+        std::optional<UnitResult> singleUnitResult;
+        if (singleUnitIndex) {
+            for (size_t i = 0; i < *singleUnitIndex; i++) {
+                if (waitsForSingleUnit(i)) {
+                    singleUnitResult = preprocessUnit(*singleUnitIndex);
+                    break;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < units.size(); i++) {
+            if (singleUnitResult && i == *singleUnitIndex)
+                ok &= emitUnit(i, *std::move(singleUnitResult));
+            else
+                ok &= emitUnit(i, preprocessUnit(i));
+        }
     }
 
-    OS::print(fmt::format("{}\n", output.str()));
-    return true;
+    return ok;
 }
 
 void Driver::reportMacros() {
@@ -1021,6 +1249,7 @@ void Driver::addParseOptions(Bag& bag) const {
     LexerOptions loptions;
     loptions.languageVersion = languageVersion;
     loptions.enableLegacyProtect = options.enableLegacyProtect == true;
+    loptions.compactTrivia = options.compactTrivia == true;
     if (options.maxLexerErrors.has_value())
         loptions.maxErrors = *options.maxLexerErrors;
 
@@ -1069,6 +1298,8 @@ void Driver::addCompilationOptions(Bag& bag) const {
     if (options.minTypMax.has_value())
         coptions.minTypMax = *options.minTypMax;
 
+    coptions.numThreads = options.numThreads.value_or(0);
+
     for (auto& [flag, value] : options.compilationFlags) {
         if (value == true)
             coptions.flags |= flag;
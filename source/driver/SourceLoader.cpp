@@ -184,6 +184,56 @@ std::vector<SourceBuffer> SourceLoader::loadSources() {
     return results;
 }
 
+std::vector<SourceLoader::SourceUnit> SourceLoader::loadSourceUnits(const Bag& optionBag) {
+    std::vector<SourceUnit> results;
+    flat_hash_map<const UnitEntry*, size_t> unitIndex;
+    std::optional<size_t> singleUnitIndex;
+
+    auto srcOptions = optionBag.getOrDefault<SourceOptions>();
+
+    // This mirrors the grouping done by loadAndParse / loadAndParseSources.
+    for (auto& entry : fileEntries) {
+        SourceManager::BufferOrError buffer;
+        if (!entry.preloadedBuffer)
+            buffer = sourceManager.readSource(entry.path, entry.library);
+        else
+            buffer = entry.preloadedBuffer;
+
+        if (!buffer) {
+            addError(entry.path, buffer.error());
+            continue;
+        }
+
+        if (entry.unit) {
+            // Separate units always inherit macros from the single unit.
+            auto [it, inserted] = unitIndex.try_emplace(entry.unit, results.size());
+            if (inserted) {
+                auto& unit = results.emplace_back();
+                unit.defines = entry.unit->defines;
+                unit.includePaths = entry.unit->includePaths;
+                unit.isLibrary = entry.unit->library != nullptr;
+                unit.inheritsMacros = true;
+            }
+            results[it->second].buffers.push_back(*buffer);
+        }
+        else if (!entry.isLibraryFile && srcOptions.singleUnit) {
+            if (!singleUnitIndex) {
+                singleUnitIndex = results.size();
+                results.emplace_back().isSingleUnit = true;
+            }
+            results[*singleUnitIndex].buffers.push_back(*buffer);
+        }
+        else {
+            auto& unit = results.emplace_back();
+            unit.buffers.push_back(*buffer);
+            unit.isLibrary = entry.isLibraryFile;
+            unit.inheritsMacros = entry.isLibraryFile && srcOptions.librariesInheritMacros;
+        }
+    }
+
+    return results;
+}
+
 SourceLoader::SyntaxTreeList SourceLoader::loadAndParseSources(const Bag& optionBag) {
     SyntaxTreeList syntaxTrees;
     std::vector<SourceBuffer> singleUnitBuffers;
@@ -198,6 +248,18 @@ SourceLoader::SyntaxTreeList SourceLoader::loadAndParseSources(const Bag& option
 
     auto srcOptions = optionBag.getOrDefault<SourceOptions>();
 
+    // Parse all of the predefined macros once up front into a shared environment
+    // so that each tree we create doesn't need to redo that work. Undefines are
+    // left in place so that they still apply after any per-unit defines.
+    auto parseOptions = optionBag;
+    auto& parsePPOptions = parseOptions.insertOrGet<parsing::PreprocessorOptions>();
+    parsePPOptions.macroEnvironment = parsing::MacroEnvironment::create(sourceManager, optionBag);
+    parsePPOptions.predefines.clear();
+
+    // Libraries that inherit macros get them via their own environment built
+    // once the main compilation unit has been parsed.
+    auto libOptions = parseOptions;
+
     auto handleLoadResult = [&](LoadResult&& result) {
         switch (result.index()) {
             case 0:
@@ -233,17 +295,22 @@ SourceLoader::SyntaxTreeList SourceLoader::loadAndParseSources(const Bag& option
     auto parseSingleUnit = [&](std::span<const SourceBuffer> buffers) {
         // If we waited to parse direct buffers due to wanting a single unit, parse that unit now.
         if (!buffers.empty()) {
-            auto tree = SyntaxTree::fromBuffers(buffers, sourceManager, optionBag);
+            auto tree = SyntaxTree::fromBuffers(buffers, sourceManager, parseOptions);
             if (srcOptions.onlyLint)
                 tree->isLibraryUnit = true;
 
             syntaxTrees.emplace_back(std::move(tree));
             inheritedMacros = syntaxTrees.back()->getDefinedMacros();
+
+            auto& libPPOptions = libOptions.insertOrGet<parsing::PreprocessorOptions>();
+            libPPOptions.macroEnvironment = parsing::MacroEnvironment::create(
+                sourceManager, parseOptions, inheritedMacros);
+            libPPOptions.undefines.clear();
         }
     };
 
     auto parseSeparateUnit = [&](const UnitEntry& unit, const std::vector<SourceBuffer>& buffers) {
-        auto unitOptions = optionBag;
+        auto unitOptions = parseOptions;
         auto& ppOptions = unitOptions.insertOrGet<parsing::PreprocessorOptions>();
         ppOptions.predefines.insert(ppOptions.predefines.end(), unit.defines.begin(),
                                     unit.defines.end());
@@ -266,7 +333,7 @@ SourceLoader::SyntaxTreeList SourceLoader::loadAndParseSources(const Bag& option
         // Load all source files that were specified on the command line
         // or via library maps.
         threadPool.detach_loop(size_t(0), fileEntries.size(), [&](size_t i) {
-            loadResults[i] = loadAndParse(fileEntries[i], optionBag, srcOptions, i);
+            loadResults[i] = loadAndParse(fileEntries[i], parseOptions, srcOptions, i);
         });
         threadPool.wait();
 
@@ -298,8 +365,8 @@ SourceLoader::SyntaxTreeList SourceLoader::loadAndParseSources(const Bag& option
             syntaxTrees.resize(numTrees + deferredLibBuffers.size());
 
             threadPool.detach_loop(size_t(0), deferredLibBuffers.size(), [&](size_t i) {
-                auto tree = SyntaxTree::fromBuffer(deferredLibBuffers[i], sourceManager, optionBag,
-                                                   inheritedMacros);
+                auto tree = SyntaxTree::fromBuffer(deferredLibBuffers[i], sourceManager,
+                                                   libOptions);
                 tree->isLibraryUnit = true;
                 syntaxTrees[i + numTrees] = std::move(tree);
             });
@@ -310,7 +377,7 @@ SourceLoader::SyntaxTreeList SourceLoader::loadAndParseSources(const Bag& option
         // Load all source files that were specified on the command line
         // or via library maps.
         for (auto& entry : fileEntries)
-            handleLoadResult(loadAndParse(entry, optionBag, srcOptions));
+            handleLoadResult(loadAndParse(entry, parseOptions, srcOptions));
 
         parseSingleUnit(singleUnitBuffers);
 
@@ -323,8 +390,7 @@ SourceLoader::SyntaxTreeList SourceLoader::loadAndParseSources(const Bag& option
         // If we deferred libraries due to wanting to inherit macros, parse them now.
         if (!deferredLibBuffers.empty()) {
             for (auto& buffer : deferredLibBuffers) {
-                auto tree = SyntaxTree::fromBuffer(buffer, sourceManager, optionBag,
-                                                   inheritedMacros);
+                auto tree = SyntaxTree::fromBuffer(buffer, sourceManager, libOptions);
                 tree->isLibraryUnit = true;
                 syntaxTrees.emplace_back(std::move(tree));
             }
@@ -332,9 +398,10 @@ SourceLoader::SyntaxTreeList SourceLoader::loadAndParseSources(const Bag& option
     }
 
     if (!searchDirectories.empty()) {
+        indexSearchDirectories(srcOptions);
         loadTrees(
             syntaxTrees, [this](std::string_view name) { return findBuffer(name); }, sourceManager,
-            optionBag, inheritedMacros);
+            libOptions, {}, srcOptions.numThreads);
     }
 
     return syntaxTrees;
@@ -476,18 +543,164 @@ SourceLoader::LoadResult SourceLoader::loadAndParse(const FileEntry& entry, cons
     }
 }
 
+void SourceLoader::loadTreesImpl(SyntaxTreeList& syntaxTrees,
+                                 function_ref<SourceBuffer(std::string_view)> findBufferFunc,
+                                 SourceManager& sourceManager, const Bag& optionBag,
+                                 std::span<const DefineDirectiveSyntax* const> inheritedMacros,
+                                 std::optional<uint32_t> numThreads) {
+    // If library directories are specified, see if we have any unknown instantiations
+    // or package names for which we should search for additional source files to load.
+    flat_hash_set<std::string_view> knownNames;
+    auto addKnownNames = [&](const std::shared_ptr<SyntaxTree>& tree) {
+        auto& meta = tree->getMetadata();
+        meta.visitDeclaredSymbols([&](std::string_view name) { knownNames.emplace(name); });
+    };
+
+    auto findMissingNames = [&](const std::shared_ptr<SyntaxTree>& tree,
+                                flat_hash_set<std::string_view>& missing) {
+        auto& meta = tree->getMetadata();
+        meta.visitReferencedSymbols([&](std::string_view name) {
+            if (knownNames.find(name) == knownNames.end())
+                missing.emplace(name);
+        });
+    };
+
+    for (auto& tree : syntaxTrees)
+        addKnownNames(tree);
+
+    flat_hash_set<std::string_view> missingNames;
+    for (auto& tree : syntaxTrees)
+        findMissingNames(tree, missingNames);
+
+    // Keep loading new files as long as we are making forward progress.
+    // Each iteration handles one "wave" of missing names; files are located
+    // in sorted name order so that the resulting list of trees doesn't depend
+    // on hash set iteration order, and then all of them are parsed at once.
+    std::optional<BS::thread_pool<>> threadPool;
+    flat_hash_set<std::string_view> nextMissingNames;
+    SmallVector<std::string_view> waveNames;
+    std::vector<SourceBuffer> waveBuffers;
+    std::vector<std::shared_ptr<SyntaxTree>> waveTrees;
+    while (true) {
+        waveNames.clear();
+        waveNames.append(missingNames.begin(), missingNames.end());
+        std::ranges::sort(waveNames);
+
+        waveBuffers.clear();
+        for (auto name : waveNames) {
+            if (auto buffer = findBufferFunc(name))
+                waveBuffers.push_back(buffer);
+        }
+
+        waveTrees.clear();
+        waveTrees.resize(waveBuffers.size());
+
+        auto parseBuffer = [&](size_t i) {
+            auto tree = SyntaxTree::fromBuffer(waveBuffers[i], sourceManager, optionBag,
+                                               inheritedMacros);
+            tree->isLibraryUnit = true;
+            waveTrees[i] = std::move(tree);
+        };
+
+        if (waveBuffers.size() >= MinFilesForThreading && numThreads != 1u) {
+            if (!threadPool)
+                threadPool.emplace(numThreads.value_or(0u));
+
+            threadPool->detach_loop(size_t(0), waveBuffers.size(), parseBuffer);
+            threadPool->wait();
+        }
+        else {
+            for (size_t i = 0; i < waveBuffers.size(); i++)
+                parseBuffer(i);
+        }
+
+        // Register everything declared in this wave before looking for
+        // missing names so that references between files in the same
+        // wave don't get searched for again.
+        for (auto& tree : waveTrees) {
+            addKnownNames(tree);
+            syntaxTrees.emplace_back(tree);
+        }
+
+        for (auto& tree : waveTrees)
+            findMissingNames(tree, nextMissingNames);
+
+        if (nextMissingNames.empty())
+            break;
+
+        missingNames = std::move(nextMissingNames);
+        nextMissingNames = {};
+    }
+}
+
 void SourceLoader::addError(const std::filesystem::path& path, std::error_code ec) {
     errors.emplace_back(fmt::format("'{}': {}", getU8Str(path), ec.message()));
 }
 
+void SourceLoader::indexSearchDirectories(const SourceOptions& srcOptions) {
+    // Library directories can be large and live on slow network filesystems,
+    // so rather than probing for every combination of missing name, directory,
+    // and extension we read each directory listing exactly once.
+    //
+    // Names are stored lowercased because we don't know whether the filesystem
+    // is case sensitive; findBuffer only uses the index to rule out files that
+    // can't possibly exist and leaves the final say to the filesystem.
+    auto listDirectory = [](const fs::path& dir) {
+        flat_hash_set<std::string> fileNames;
+        std::error_code ec;
+        for (auto it = fs::directory_iterator(dir, fs::directory_options::skip_permission_denied,
+                                              ec);
+             it != fs::directory_iterator(); it.increment(ec)) {
+            if (it->is_regular_file(ec)) {
+                auto fileName = getU8Str(it->path().filename());
+                strToLower(fileName);
+                fileNames.emplace(std::move(fileName));
+            }
+        }
+        return fileNames;
+    };
+
+    searchDirectoryIndex.clear();
+    searchDirectoryIndex.resize(searchDirectories.size());
+
+    if (searchDirectories.size() >= MinFilesForThreading && srcOptions.numThreads != 1u) {
+        BS::thread_pool<> threadPool(srcOptions.numThreads.value_or(0u));
+        threadPool.detach_loop(size_t(0), searchDirectories.size(), [&](size_t i) {
+            searchDirectoryIndex[i] = listDirectory(searchDirectories[i]);
+        });
+        threadPool.wait();
+    }
+    else {
+        for (size_t i = 0; i < searchDirectories.size(); i++)
+            searchDirectoryIndex[i] = listDirectory(searchDirectories[i]);
+    }
+}
+
 SourceBuffer SourceLoader::findBuffer(std::string_view name) {
+    SLANG_ASSERT(searchDirectoryIndex.size() == searchDirectories.size());
+
+    SmallVector<fs::path> fileNames;
+    SmallVector<std::string> foldedNames;
+    fs::path fileName(name);
+    for (auto& ext : searchExtensions) {
+        fileName.replace_extension(ext);
+        fileNames.push_back(fileName);
+
+        auto& folded = foldedNames.emplace_back(getU8Str(fileName));
+        strToLower(folded);
+    }
+
     SourceBuffer buffer;
-    for (auto& dir : searchDirectories) {
-        fs::path path(dir);
-        path /= name;
+    for (size_t i = 0; i < searchDirectories.size(); i++) {
+        auto& index = searchDirectoryIndex[i];
+        for (size_t j = 0; j < fileNames.size(); j++) {
+            if (!index.contains(foldedNames[j]))
+                continue;
 
-        for (auto& ext : searchExtensions) {
-            path.replace_extension(ext);
+            // A case-insensitive match might still not exist on a
+            // case-sensitive filesystem, in which case reading fails
+            // and we move on just like we would without the index.
+            auto path = searchDirectories[i] / fileNames[j];
             if (!sourceManager.isCached(path)) {
                 // This file is never part of a library because if
                 // it was we would have already loaded it earlier.
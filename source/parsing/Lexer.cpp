@@ -249,7 +249,7 @@ Token Lexer::lex(KeywordVersion keywordVersion) {
         sourceBuffer = sourceEnd - 1;
 
         triviaBuffer.push_back(Trivia(TriviaKind::DisabledText, lexeme()));
-        return Token(alloc, TokenKind::EndOfFile, triviaBuffer.copy(alloc), token.rawText(),
+        return Token(alloc, TokenKind::EndOfFile, copyTrivia(), token.rawText(),
                      token.location());
     }
 
@@ -1601,8 +1601,45 @@ void Lexer::scanDisabledRegion(std::string_view firstWord, std::string_view seco
 template<typename... Args>
 Token Lexer::create(TokenKind kind, Args&&... args) {
     SourceLocation location(bufferId, size_t(marker - originalBegin));
-    return Token(alloc, kind, triviaBuffer.copy(alloc), lexeme(), location,
-                 std::forward<Args>(args)...);
+    return Token(alloc, kind, copyTrivia(), lexeme(), location, std::forward<Args>(args)...);
+}
+
+std::span<Trivia const> Lexer::copyTrivia() {
+    if (!options.compactTrivia || retainTrivia || triviaBuffer.empty())
+        return triviaBuffer.copy(alloc);
+
+    // If all we have is whitespace and comments we can substitute a shared
+    // placeholder instead of allocating, as long as we preserve whether there
+    // was any trivia at all and whether it ended the line, which is what the
+    // preprocessor and parser care about.
+    bool newline = false;
+    for (auto& trivia : triviaBuffer) {
+        switch (trivia.kind) {
+            case TriviaKind::Whitespace:
+                break;
+            case TriviaKind::EndOfLine:
+                newline = true;
+                break;
+            case TriviaKind::LineComment:
+                // Line comments can end with a continuation, which matters for macros.
+                if (trivia.getRawText().ends_with('\\'))
+                    return triviaBuffer.copy(alloc);
+                newline = true;
+                break;
+            case TriviaKind::BlockComment:
+                if (trivia.getRawText().find_first_of("\r\n") != std::string_view::npos)
+                    newline = true;
+                break;
+            default:
+                return triviaBuffer.copy(alloc);
+        }
+    }
+
+    static const Trivia spaceTrivia[] = {Trivia(TriviaKind::Whitespace, " "sv)};
+    static const Trivia newlineTrivia[] = {Trivia(TriviaKind::EndOfLine, "\n"sv)};
+    if (newline)
+        return newlineTrivia;
+    return spaceTrivia;
 }
 
 void Lexer::addTrivia(TriviaKind kind) {
@@ -1111,14 +1111,70 @@ PortConnectionSyntax& Parser::parsePortConnection() {
 
         if (peek(TokenKind::OpenParenthesis)) {
             openParen = consume();
-            if (!peek(TokenKind::CloseParenthesis))
-                expr = &parsePropertyExpr(0);
+            if (!peek(TokenKind::CloseParenthesis)) {
+                expr = parseSimplePortExpr(TokenKind::CloseParenthesis);
+                if (!expr)
+                    expr = &parsePropertyExpr(0);
+            }
 
             closeParen = expect(TokenKind::CloseParenthesis);
         }
         return factory.namedPortConnection(attributes, dot, name, openParen, expr, closeParen);
     }
-    return factory.orderedPortConnection(attributes, parsePropertyExpr(0));
+
+    auto expr = parseSimplePortExpr(TokenKind::Comma);
+    if (!expr)
+        expr = &parsePropertyExpr(0);
+
+    return factory.orderedPortConnection(attributes, *expr);
+}
+
+PropertyExprSyntax* Parser::parseSimplePortExpr(TokenKind endKind) {
+    // Netlists are made up almost entirely of port connections to plain names
+    // or constant bit / part selects of names. Recognize those up front so that
+    // we can build the resulting nodes directly instead of going through the
+    // full property, sequence, and expression parsing stack for each one.
+    // Anything else returns nullptr so that the caller uses the general path.
+    if (peek().kind != TokenKind::Identifier)
+        return nullptr;
+
+    uint32_t index = 1;
+    while (peek(index).kind == TokenKind::OpenBracket) {
+        if (peek(++index).kind != TokenKind::IntegerLiteral)
+            return nullptr;
+
+        auto next = peek(++index).kind;
+        if (next == TokenKind::Colon) {
+            if (peek(++index).kind != TokenKind::IntegerLiteral)
+                return nullptr;
+            next = peek(++index).kind;
+        }
+
+        if (next != TokenKind::CloseBracket)
+            return nullptr;
+        index++;
+    }
+
+    auto next = peek(index).kind;
+    if (next != TokenKind::CloseParenthesis && next != endKind)
+        return nullptr;
+
+    auto identifier = consume();
+
+    NameSyntax* name;
+    if (index == 1) {
+        name = &factory.identifierName(identifier);
+    }
+    else {
+        SmallVector<ElementSelectSyntax*> buffer;
+        do {
+            buffer.push_back(&parseElementSelect());
+        } while (peek(TokenKind::OpenBracket));
+
+        name = &factory.identifierSelectName(identifier, buffer.copy(alloc));
+    }
+
+    return &factory.simplePropertyExpr(factory.simpleSequenceExpr(*name, nullptr));
 }
 
 bool Parser::isMember() {
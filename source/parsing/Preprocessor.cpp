@@ -32,13 +32,20 @@ Preprocessor::Preprocessor(SourceManager& sourceManager, BumpAllocator& alloc,
 
     keywordVersionStack.push_back(LF::getDefaultKeywordVersion(options.languageVersion));
     resetAllDirectives();
-    undefineAll();
+
+    // Any problems with the predefines in a shared environment were reported
+    // when it was built; copy them so that we look the same as if we had
+    // parsed the predefines ourselves.
+    if (options.macroEnvironment)
+        diagnostics.append_range(options.macroEnvironment->getDiagnostics());
+
+    resetMacros(options.macroEnvironment.get());
 
     // Add in any inherited macros that aren't already set in our map.
     for (auto define : inheritedMacros) {
         auto name = define->name.valueText();
-        if (!name.empty())
-            macros.emplace(name, define);
+        if (!name.empty() && !lookupMacro(name))
+            macros[name] = define;
     }
 
     // clang-format off
@@ -120,25 +127,58 @@ void Preprocessor::predefine(const std::string& definition, std::string_view nam
     // Look for the macro in the temporary preprocessor's macro map.
     // Any macros found that are not the built-in intrinsic macros should
     // be copied over to our own map.
-    for (auto& pair : pp.macros) {
-        if (!pair.second.isIntrinsic()) {
-            pair.second.commandLine = true;
-            macros.insert(pair);
+    for (auto& [name, def] : pp.macros) {
+        if (!def.isIntrinsic() && !lookupMacro(name)) {
+            def.commandLine = true;
+            macros[name] = def;
         }
     }
 }
 
 bool Preprocessor::undefine(std::string_view name) {
-    auto it = macros.find(name);
-    if (it != macros.end() && !it->second.isIntrinsic()) {
-        macros.erase(it);
+    auto def = lookupMacro(name);
+    if (def && !def->isIntrinsic()) {
+        removeMacro(name);
         return true;
     }
     return false;
 }
 
 void Preprocessor::undefineAll() {
+    // Inherited macros don't survive an `undefineall, so if our shared
+    // environment contains any we reset to the version without them.
+    auto environment = options.macroEnvironment.get();
+    if (environment && environment->withoutInherited)
+        environment = environment->withoutInherited.get();
+
+    resetMacros(environment);
+}
+
+void Preprocessor::resetMacros(const MacroEnvironment* environment) {
     macros.clear();
+
+    // If we have a shared environment it already contains the
+    // built-in macros, so just reset back to it.
+    baseMacros = environment;
+    if (!baseMacros)
+        createBuiltInMacros();
+
+    for (std::string predef : options.predefines) {
+        // Find location of equals sign to indicate start of body.
+        // If there is no equals sign, predefine to a value of 1.
+        size_t index = predef.find('=');
+        if (index != std::string::npos)
+            predef[index] = ' ';
+        else
+            predef += " 1";
+        predefine(predef, options.predefineSource);
+    }
+
+    for (const std::string& undef : options.undefines)
+        undefine(undef);
+}
+
+void Preprocessor::createBuiltInMacros() {
     macros["__FILE__"] = MacroIntrinsic::File;
     macros["__LINE__"] = MacroIntrinsic::Line;
 
@@ -163,24 +203,10 @@ void Preprocessor::undefineAll() {
     DEFINE("SV_COV_OK"sv, 1);
     DEFINE("SV_COV_PARTIAL"sv, 2);
 #undef DEFINE
-
-    for (std::string predef : options.predefines) {
-        // Find location of equals sign to indicate start of body.
-        // If there is no equals sign, predefine to a value of 1.
-        size_t index = predef.find('=');
-        if (index != std::string::npos)
-            predef[index] = ' ';
-        else
-            predef += " 1";
-        predefine(predef, options.predefineSource);
-    }
-
-    for (const std::string& undef : options.undefines)
-        undefine(undef);
 }
 
 bool Preprocessor::isDefined(std::string_view name) {
-    return !name.empty() && macros.find(name) != macros.end();
+    return !name.empty() && lookupMacro(name);
 }
 
 void Preprocessor::setKeywordVersion(KeywordVersion version) {
@@ -201,6 +227,14 @@ const SourceLibrary* Preprocessor::getCurrentLibrary() const {
 
 std::vector<const DefineDirectiveSyntax*> Preprocessor::getDefinedMacros() const {
     std::vector<const DefineDirectiveSyntax*> results;
+    if (baseMacros) {
+        results.reserve(baseMacros->macros.size() + macros.size());
+        for (auto& [name, def] : baseMacros->macros) {
+            if (def.syntax && !macros.contains(name))
+                results.push_back(def.syntax);
+        }
+    }
+
     for (auto& [name, def] : macros) {
         if (def.syntax)
             results.push_back(def.syntax);
@@ -433,6 +467,7 @@ Token Preprocessor::nextRaw() {
     // Pull the next token from the active source.
     // This is the common case.
     auto& source = lexerStack.back();
+    source->setRetainTrivia(inMacroBody);
     auto token = source->lex(keywordVersionStack.back());
     if (token.kind != TokenKind::EndOfFile)
         return token;
@@ -464,6 +499,7 @@ Token Preprocessor::nextRaw() {
 
     while (true) {
         auto& nextSource = lexerStack.back();
+        nextSource->setRetainTrivia(inMacroBody);
         token = nextSource->lex(keywordVersionStack.back());
         appendTrivia(token);
         if (token.kind != TokenKind::EndOfFile)
@@ -684,17 +720,17 @@ Trivia Preprocessor::handleDefineDirective(Token directive) {
     auto result = alloc.emplace<DefineDirectiveSyntax>(directive, name, formalArguments,
                                                        scratchTokenBuffer.copy(alloc));
 
-    if (auto it = macros.find(name.valueText()); it != macros.end()) {
-        if (it->second.builtIn) {
+    if (auto existing = lookupMacro(name.valueText())) {
+        if (existing->builtIn) {
             addDiag(diag::InvalidMacroName, name.range());
             bad = true;
         }
-        else if (it->second.commandLine)
+        else if (existing->commandLine)
             bad = true; // not really bad, but commandLine args has precedence so we skip this
-        else if (!bad && it->second.valid() && !isSameMacro(*result, *it->second.syntax)) {
+        else if (!bad && !isSameMacro(*result, *existing->syntax)) {
             auto& diag = addDiag(diag::RedefiningMacro, name.range());
             diag << name.valueText();
-            diag.addNote(diag::NotePreviousDefinition, it->second.syntax->name.location());
+            diag.addNote(diag::NotePreviousDefinition, existing->syntax->name.location());
         }
     }
 
@@ -973,10 +1009,9 @@ Trivia Preprocessor::handleUndefDirective(Token directive) {
 
     if (!nameToken.isMissing()) {
         std::string_view name = nameToken.valueText();
-        auto it = macros.find(name);
-        if (it != macros.end()) {
-            if (!it->second.builtIn)
-                macros.erase(it);
+        if (auto def = lookupMacro(name)) {
+            if (!def->builtIn)
+                removeMacro(name);
             else
                 addDiag(diag::UndefineBuiltinDirective, nameToken.range());
         }
@@ -1254,9 +1289,9 @@ bool Preprocessor::evalConditionalExpr(
             }
         }
         case SyntaxKind::NamedConditionalDirectiveExpression:
-            return macros.find(
+            return lookupMacro(
                        expr.as<NamedConditionalDirectiveExpressionSyntax>().name.valueText()) !=
-                   macros.end();
+                   nullptr;
         default:
             SLANG_UNREACHABLE;
     }
@@ -11,6 +11,7 @@
 #include "slang/syntax/AllSyntax.h"
 #include "slang/syntax/SyntaxFacts.h"
 #include "slang/text/SourceManager.h"
+#include "slang/util/PerfCounters.h"
 #include "slang/util/String.h"
 
 namespace slang::parsing {
@@ -24,10 +25,29 @@ Preprocessor::MacroDef Preprocessor::findMacro(Token directive) {
     if (!name.empty() && name[0] == '\\')
         name = name.substr(1);
 
-    auto it = macros.find(name);
-    if (it == macros.end())
-        return nullptr;
-    return it->second;
+    if (auto def = lookupMacro(name))
+        return *def;
+    return nullptr;
+}
+
+const Preprocessor::MacroDef* Preprocessor::lookupMacro(std::string_view name) const {
+    if (auto it = macros.find(name); it != macros.end())
+        return it->second.valid() ? &it->second : nullptr;
+
+    if (baseMacros) {
+        if (auto it = baseMacros->macros.find(name); it != baseMacros->macros.end())
+            return &it->second;
+    }
+    return nullptr;
+}
+
+void Preprocessor::removeMacro(std::string_view name) {
+    // If the base environment has the macro we need to leave
+    // behind an invalid entry to hide it.
+    if (baseMacros && baseMacros->macros.contains(name))
+        macros[name] = MacroDef();
+    else
+        macros.erase(name);
 }
 
 void Preprocessor::createBuiltInMacro(std::string_view name, int value, std::string_view valueStr) {
@@ -404,6 +424,8 @@ bool Preprocessor::applyMacroOps(std::span<Token const> tokens, SmallVectorBase<
 
 bool Preprocessor::expandMacro(MacroDef macro, MacroExpansion& expansion,
                                MacroActualArgumentListSyntax* actualArgs) {
+    PerfCounters::increment(PerfCounter::MacroExpansions);
+
     if (macro.isIntrinsic()) {
         // for now, no intrisics can have arguments
         SLANG_ASSERT(!actualArgs);
@@ -983,4 +1005,58 @@ bool Preprocessor::isSameMacro(const DefineDirectiveSyntax& left,
     return isSameTokenList(left.body, right.body);
 }
 
+std::shared_ptr<const MacroEnvironment> MacroEnvironment::create(
+    SourceManager& sourceManager, const Bag& options,
+    std::span<const DefineDirectiveSyntax* const> inheritedMacros) {
+
+    std::shared_ptr<MacroEnvironment> env(new MacroEnvironment());
+
+    // Run a preprocessor with no source to get it to apply all of the
+    // predefines and then flatten its view of the macros into our own map.
+    Preprocessor pp(sourceManager, env->alloc, env->diagnostics, options, inheritedMacros);
+    if (pp.baseMacros) {
+        env->parent = pp.options.macroEnvironment;
+        env->macros = pp.baseMacros->macros;
+    }
+
+    for (auto& [name, def] : pp.macros) {
+        if (def.valid())
+            env->macros[name] = def;
+        else
+            env->macros.erase(name);
+    }
+
+    // Build the same environment without any inherited macros (including
+    // those from the environment we're building on) for `undefineall to use.
+    auto& base = pp.options.macroEnvironment;
+    if (!inheritedMacros.empty()) {
+        env->withoutInherited = create(sourceManager, options);
+    }
+    else if (base && base->withoutInherited) {
+        auto baseOptions = options;
+        baseOptions.insertOrGet<PreprocessorOptions>().macroEnvironment = base->withoutInherited;
+        env->withoutInherited = create(sourceManager, baseOptions);
+    }
+
+    return env;
+}
+
+bool MacroEnvironment::isDefined(std::string_view name) const {
+    return macros.contains(name);
+}
+
+std::vector<const DefineDirectiveSyntax*> MacroEnvironment::getDefinedMacros() const {
+    std::vector<const DefineDirectiveSyntax*> results;
+    results.reserve(macros.size());
+    for (auto& [name, def] : macros) {
+        if (def.syntax)
+            results.push_back(def.syntax);
+    }
+
+    std::ranges::sort(results, [](const DefineDirectiveSyntax* a, const DefineDirectiveSyntax* b) {
+        return a->name.valueText() < b->name.valueText();
+    });
+    return results;
+}
+
 } // namespace slang::parsing
@@ -18,7 +18,8 @@
 
 namespace slang::syntax {
 
-CSTSerializer::CSTSerializer(JsonWriter& writer, CSTJsonMode mode) : writer(writer), mode(mode) {
+CSTSerializer::CSTSerializer(DocumentWriter& writer, CSTJsonMode mode) :
+    writer(writer), mode(mode) {
 }
 
 void CSTSerializer::serialize(const SyntaxTree& tree) {
@@ -34,10 +35,10 @@ template<typename T>
 struct always_false : std::false_type {};
 
 struct CSTJsonVisitor {
-    JsonWriter& writer;
+    DocumentWriter& writer;
     CSTJsonMode mode;
 
-    CSTJsonVisitor(JsonWriter& w, CSTJsonMode m) : writer(w), mode(m) {}
+    CSTJsonVisitor(DocumentWriter& w, CSTJsonMode m) : writer(w), mode(m) {}
 
     template<std::derived_from<SyntaxNode> T>
     void visit(const T& node) {
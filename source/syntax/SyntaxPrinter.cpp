@@ -7,6 +7,9 @@
 //------------------------------------------------------------------------------
 #include "slang/syntax/SyntaxPrinter.h"
 
+#include <fmt/format.h>
+#include <ostream>
+
 #include "slang/parsing/ParserMetadata.h"
 #include "slang/syntax/SyntaxNode.h"
 #include "slang/syntax/SyntaxTree.h"
@@ -17,9 +20,32 @@ namespace slang::syntax {
 
 using namespace parsing;
 
+// When streaming, the amount of buffered text at which we flush to the stream.
+static constexpr size_t FlushThreshold = 64 * 1024;
+
 SyntaxPrinter::SyntaxPrinter(const SourceManager& sourceManager) : sourceManager(&sourceManager) {
 }
 
+SyntaxPrinter::SyntaxPrinter(std::ostream& stream) : stream(&stream) {
+}
+
+SyntaxPrinter::SyntaxPrinter(const SourceManager& sourceManager, std::ostream& stream) :
+    sourceManager(&sourceManager), stream(&stream) {
+}
+
+void SyntaxPrinter::flush() {
+    if (stream && !buffer.empty()) {
+        stream->write(buffer.data(), std::streamsize(buffer.size()));
+        lastFlushedChar = buffer.back();
+        buffer.clear();
+    }
+}
+
+void SyntaxPrinter::flushIfNeeded() {
+    if (stream && buffer.size() >= FlushThreshold)
+        flush();
+}
+
 SyntaxPrinter& SyntaxPrinter::print(Trivia trivia) {
     switch (trivia.kind) {
         case TriviaKind::Directive: {
@@ -61,6 +87,7 @@ SyntaxPrinter& SyntaxPrinter::print(Trivia trivia) {
 
 SyntaxPrinter& SyntaxPrinter::print(Token token) {
     bool excluded = !shouldPrint(token.location());
+    size_t triviaStart = buffer.size();
 
     if (includeTrivia) {
         if (!sourceManager) {
@@ -101,12 +128,64 @@ SyntaxPrinter& SyntaxPrinter::print(Token token) {
         }
     }
 
-    if (!excluded && (includeMissing || !token.isMissing()))
+    if (!excluded && (includeMissing || !token.isMissing())) {
+        if (emitLineDirectives && sourceManager)
+            addLineDirective(token, triviaStart);
         append(token.rawText());
+    }
 
+    // Only flush between tokens, so that line directives can
+    // still be inserted ahead of a token's leading trivia.
+    flushIfNeeded();
     return *this;
 }
 
+void SyntaxPrinter::addLineDirective(Token token, size_t triviaStart) {
+    auto loc = sourceManager->getFullyExpandedLoc(token.location());
+    auto newBuffer = loc.buffer();
+    if (!newBuffer || newBuffer == lastBuffer)
+        return;
+
+    // The level tells consumers whether we just entered an include
+    // file (1), returned from one (2), or neither (0).
+    auto isIncludedFrom = [&](BufferID buffer, BufferID parent) {
+        while (buffer) {
+            buffer = sourceManager->getIncludedFrom(buffer).buffer();
+            if (buffer == parent)
+                return true;
+        }
+        return false;
+    };
+
+    int level = 0;
+    if (lastBuffer) {
+        if (isIncludedFrom(newBuffer, lastBuffer))
+            level = 1;
+        else if (isIncludedFrom(lastBuffer, newBuffer))
+            level = 2;
+    }
+    lastBuffer = newBuffer;
+
+    // The directive goes at the start of the line the token is on. Leading
+    // trivia can come from the previous file (e.g. the rest of the line
+    // with an include directive on it), so only look back as far as the
+    // last newline, and if there isn't one start a new line.
+    size_t pos = buffer.size();
+    while (pos > triviaStart && buffer[pos - 1] != '\n')
+        pos--;
+
+    std::string directive;
+    char prev = pos ? buffer[pos - 1] : lastFlushedChar;
+    if (pos == triviaStart && prev && prev != '\n') {
+        pos = buffer.size();
+        directive.push_back('\n');
+    }
+
+    directive += fmt::format("`line {} \"{}\" {}\n", sourceManager->getLineNumber(loc),
+                             sourceManager->getFileName(loc), level);
+    buffer.insert(pos, directive);
+}
+
 SyntaxPrinter& SyntaxPrinter::print(const SyntaxNode& node) {
     size_t childCount = node.getChildCount();
     for (size_t i = 0; i < childCount; i++) {
@@ -164,7 +243,8 @@ SyntaxPrinter& SyntaxPrinter::append(std::string_view text) {
         text = text.substr(i);
     }
 
-    if (buffer.empty() || buffer.back() != '\n') {
+    char last = buffer.empty() ? lastFlushedChar : buffer.back();
+    if (last != '\n') {
         if (carriage)
             buffer.push_back('\r');
         if (newline)
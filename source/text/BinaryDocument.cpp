@@ -0,0 +1,299 @@
+//------------------------------------------------------------------------------
+// BinaryDocument.cpp
+// Compact binary encoding for structured (JSON-like) documents
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/text/BinaryDocument.h"
+
+#include <bit>
+#include <ostream>
+#include <vector>
+
+namespace slang {
+
+namespace {
+
+enum Tag : uint8_t {
+    StartObject = 1,
+    EndObject,
+    StartArray,
+    EndArray,
+    Property,
+    String,
+    SignedInt,
+    UnsignedInt,
+    Double,
+    True,
+    False
+};
+
+constexpr std::string_view Magic = "SLBD";
+
+// Strings longer than this are written inline instead of being
+// added to the string table; they're unlikely to repeat.
+constexpr size_t MaxInternedLength = 256;
+
+// Amount of buffered output at which we flush to the stream.
+constexpr size_t FlushThreshold = 64 * 1024;
+
+} // namespace
+
+BinaryDocumentWriter::BinaryDocumentWriter(std::ostream& stream) : stream(stream) {
+    buffer.append(Magic);
+    buffer.push_back(char(Version));
+}
+
+BinaryDocumentWriter::~BinaryDocumentWriter() {
+    flush();
+}
+
+void BinaryDocumentWriter::startObject() {
+    writeTag(StartObject);
+}
+
+void BinaryDocumentWriter::endObject() {
+    writeTag(EndObject);
+}
+
+void BinaryDocumentWriter::startArray() {
+    writeTag(StartArray);
+}
+
+void BinaryDocumentWriter::endArray() {
+    writeTag(EndArray);
+}
+
+void BinaryDocumentWriter::writeProperty(std::string_view name) {
+    writeTag(Property);
+    writeString(name);
+}
+
+void BinaryDocumentWriter::writeValue(std::string_view value) {
+    writeTag(String);
+    writeString(value);
+}
+
+void BinaryDocumentWriter::writeValue(int64_t value) {
+    writeTag(SignedInt);
+    writeVarint((uint64_t(value) << 1) ^ uint64_t(value >> 63));
+}
+
+void BinaryDocumentWriter::writeValue(uint64_t value) {
+    writeTag(UnsignedInt);
+    writeVarint(value);
+}
+
+void BinaryDocumentWriter::writeValue(double value) {
+    writeTag(Double);
+    auto bits = std::bit_cast<uint64_t>(value);
+    for (int i = 0; i < 8; i++) {
+        buffer.push_back(char(bits & 0xff));
+        bits >>= 8;
+    }
+}
+
+void BinaryDocumentWriter::writeValue(bool value) {
+    writeTag(value ? True : False);
+}
+
+void BinaryDocumentWriter::flush() {
+    stream.write(buffer.data(), std::streamsize(buffer.size()));
+    buffer.clear();
+}
+
+void BinaryDocumentWriter::writeTag(uint8_t tag) {
+    if (buffer.size() >= FlushThreshold)
+        flush();
+    buffer.push_back(char(tag));
+}
+
+void BinaryDocumentWriter::writeVarint(uint64_t value) {
+    while (value >= 0x80) {
+        buffer.push_back(char((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(char(value));
+}
+
+void BinaryDocumentWriter::writeString(std::string_view str) {
+    if (str.size() > MaxInternedLength) {
+        writeVarint(1);
+    }
+    else if (stringTable.size() < MaxStringTableSize) {
+        auto [it, inserted] = stringTable.try_emplace(std::string(str), stringTable.size());
+        if (!inserted) {
+            writeVarint(it->second + 2);
+            return;
+        }
+        writeVarint(0);
+    }
+    else {
+        // The table is full; keep using the strings that made it in
+        // but write everything else inline.
+        if (auto it = stringTable.find(std::string(str)); it != stringTable.end()) {
+            writeVarint(it->second + 2);
+            return;
+        }
+        writeVarint(1);
+    }
+
+    writeVarint(str.size());
+    buffer.append(str);
+}
+
+namespace {
+
+class Decoder {
+public:
+    Decoder(std::string_view data, DocumentWriter& writer) : data(data), writer(writer) {}
+
+    bool run() {
+        if (!data.starts_with(Magic) || data.size() < Magic.size() + 1 ||
+            uint8_t(data[Magic.size()]) != BinaryDocumentWriter::Version) {
+            return false;
+        }
+
+        pos = Magic.size() + 1;
+        while (pos < data.size()) {
+            if (!readEvent())
+                return false;
+        }
+
+        // Every object and array must have been closed.
+        return containers.empty();
+    }
+
+private:
+    bool readEvent() {
+        switch (uint8_t(data[pos++])) {
+            case StartObject:
+                containers.push_back(StartObject);
+                writer.startObject();
+                return true;
+            case EndObject:
+                if (!popContainer(StartObject))
+                    return false;
+                writer.endObject();
+                return true;
+            case StartArray:
+                containers.push_back(StartArray);
+                writer.startArray();
+                return true;
+            case EndArray:
+                if (!popContainer(StartArray))
+                    return false;
+                writer.endArray();
+                return true;
+            case Property: {
+                std::string_view str;
+                if (!readString(str))
+                    return false;
+                writer.writeProperty(str);
+                return true;
+            }
+            case String: {
+                std::string_view str;
+                if (!readString(str))
+                    return false;
+                writer.writeValue(str);
+                return true;
+            }
+            case SignedInt: {
+                uint64_t value;
+                if (!readVarint(value))
+                    return false;
+                writer.writeValue(int64_t(value >> 1) ^ -int64_t(value & 1));
+                return true;
+            }
+            case UnsignedInt: {
+                uint64_t value;
+                if (!readVarint(value))
+                    return false;
+                writer.writeValue(value);
+                return true;
+            }
+            case Double: {
+                if (data.size() - pos < 8)
+                    return false;
+
+                uint64_t bits = 0;
+                for (int i = 7; i >= 0; i--)
+                    bits = (bits << 8) | uint8_t(data[pos + size_t(i)]);
+                pos += 8;
+
+                writer.writeValue(std::bit_cast<double>(bits));
+                return true;
+            }
+            case True:
+                writer.writeValue(true);
+                return true;
+            case False:
+                writer.writeValue(false);
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    bool popContainer(uint8_t startTag) {
+        if (containers.empty() || containers.back() != startTag)
+            return false;
+
+        containers.pop_back();
+        return true;
+    }
+
+    bool readVarint(uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (pos >= data.size())
+                return false;
+
+            auto byte = uint8_t(data[pos++]);
+            value |= uint64_t(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+                return true;
+        }
+        return false;
+    }
+
+    bool readString(std::string_view& result) {
+        uint64_t ref;
+        if (!readVarint(ref))
+            return false;
+
+        if (ref >= 2) {
+            if (ref - 2 >= strings.size())
+                return false;
+            result = strings[ref - 2];
+            return true;
+        }
+
+        uint64_t length;
+        if (!readVarint(length) || length > data.size() - pos)
+            return false;
+
+        result = data.substr(pos, length);
+        pos += length;
+
+        if (ref == 0)
+            strings.push_back(result);
+        return true;
+    }
+
+    std::string_view data;
+    DocumentWriter& writer;
+    std::vector<std::string_view> strings;
+    std::vector<uint8_t> containers;
+    size_t pos = 0;
+};
+
+} // namespace
+
+bool BinaryDocumentReader::read(std::string_view data, DocumentWriter& writer) {
+    return Decoder(data, writer).run();
+}
+
+} // namespace slang
@@ -8,6 +8,7 @@
 #include "slang/text/Json.h"
 
 #include <climits>
+#include <ostream>
 
 #include "slang/text/FormatBuffer.h"
 #include "slang/util/SmallVector.h"
@@ -15,87 +16,121 @@
 
 namespace slang {
 
+// When streaming, the amount of buffered text at which we flush to the stream.
+static constexpr size_t FlushThreshold = 64 * 1024;
+
 JsonWriter::JsonWriter() : buffer(std::make_unique<FormatBuffer>()) {
 }
 
-JsonWriter::~JsonWriter() = default;
+JsonWriter::JsonWriter(std::ostream& stream) :
+    buffer(std::make_unique<FormatBuffer>()), stream(&stream) {
+}
+
+JsonWriter::~JsonWriter() {
+    if (stream && buffer->size())
+        stream->write(buffer->data(), std::streamsize(buffer->size()));
+}
 
 std::string_view JsonWriter::view() const {
-    return std::string_view(buffer->data(), findLastComma());
+    return std::string_view(buffer->data(), buffer->size());
+}
+
+void JsonWriter::flush() {
+    if (stream) {
+        stream->write(buffer->data(), std::streamsize(buffer->size()));
+        buffer->clear();
+    }
 }
 
 void JsonWriter::startObject() {
+    startValue();
     buffer->append("{");
-    if (pretty) {
-        currentIndent += indentSize;
-        buffer->format("\n{:{}}", "", currentIndent);
-    }
+    currentIndent += indentSize;
+    depth++;
+    needComma = false;
 }
 
 void JsonWriter::endObject() {
-    buffer->resize(findLastComma());
-    if (pretty) {
-        currentIndent -= indentSize;
-        buffer->format("\n{:{}}}}", "", currentIndent);
-        endValue();
-    }
-    else {
-        buffer->append("},");
-    }
+    currentIndent -= indentSize;
+    depth--;
+    if (pretty)
+        buffer->format("\n{:{}}", "", currentIndent);
+    buffer->append("}");
+    endValue();
 }
 
 void JsonWriter::startArray() {
+    startValue();
     buffer->append("[");
-    if (pretty) {
-        currentIndent += indentSize;
-        buffer->format("\n{:{}}", "", currentIndent);
-    }
+    currentIndent += indentSize;
+    depth++;
+    needComma = false;
 }
 
 void JsonWriter::endArray() {
-    buffer->resize(findLastComma());
-    if (pretty) {
-        currentIndent -= indentSize;
-        buffer->format("\n{:{}}]", "", currentIndent);
-        endValue();
-    }
-    else {
-        buffer->append("],");
-    }
+    currentIndent -= indentSize;
+    depth--;
+    if (pretty)
+        buffer->format("\n{:{}}", "", currentIndent);
+    buffer->append("]");
+    endValue();
 }
 
 void JsonWriter::writeProperty(std::string_view name) {
+    startValue();
     writeQuoted(name);
     buffer->append(":");
     if (pretty)
         buffer->append(" ");
+    afterProperty = true;
 }
 
 void JsonWriter::writeValue(std::string_view value) {
+    startValue();
     writeQuoted(value);
     endValue();
 }
 
 void JsonWriter::writeValue(int64_t value) {
+    startValue();
     buffer->format("{}", value);
     endValue();
 }
 
 void JsonWriter::writeValue(uint64_t value) {
+    startValue();
     buffer->format("{}", value);
     endValue();
 }
 
 void JsonWriter::writeValue(double value) {
+    startValue();
     buffer->format("{}", value);
     endValue();
 }
 
 void JsonWriter::writeValue(bool value) {
+    startValue();
     buffer->append(value ? "true" : "false");
     endValue();
 }
 
+void JsonWriter::writeRawValue(std::string_view json) {
+    startValue();
+    if (pretty && currentIndent > 0) {
+        // Quoted strings never contain raw newlines, so every
+        // newline in the text is a line break that needs indenting.
+        size_t pos;
+        while ((pos = json.find('\n')) != std::string_view::npos) {
+            buffer->append(json.substr(0, pos + 1));
+            buffer->format("{:{}}", "", currentIndent);
+            json = json.substr(pos + 1);
+        }
+    }
+    buffer->append(json);
+    endValue();
+}
+
 void JsonWriter::writeNewLine() {
     buffer->append("\n");
 }
@@ -158,23 +193,26 @@ void JsonWriter::writeQuoted(std::string_view str) {
     buffer->append(toStringView(vec));
 }
 
-void JsonWriter::endValue() {
-    buffer->append(",");
-    if (pretty)
-        buffer->format("\n{:{}}", "", currentIndent);
-}
-
-size_t JsonWriter::findLastComma() const {
-    size_t size = buffer->size();
-    if (pretty) {
-        while (size && (buffer->data()[size - 1] == ' ' || buffer->data()[size - 1] == '\n'))
-            size--;
+void JsonWriter::startValue() {
+    // A property's value directly follows its name.
+    if (afterProperty) {
+        afterProperty = false;
+        return;
     }
 
-    if (size && buffer->data()[size - 1] == ',')
-        size--;
+    // Separators are emitted ahead of each value (rather than after it)
+    // so that nothing ever needs to be removed from the output, which
+    // lets us stream it out as we go.
+    if (needComma)
+        buffer->append(",");
+    if (pretty && (needComma || depth))
+        buffer->format("\n{:{}}", "", currentIndent);
+}
 
-    return size;
+void JsonWriter::endValue() {
+    needComma = true;
+    if (stream && buffer->size() >= FlushThreshold)
+        flush();
 }
 
 } // namespace slang
@@ -9,6 +9,8 @@
 
 #include <new>
 
+#include "slang/util/PerfCounters.h"
+
 namespace slang {
 
 BumpAllocator::BumpAllocator() {
@@ -65,6 +67,8 @@ byte* BumpAllocator::allocateSlow(size_t size, size_t alignment) {
 }
 
 BumpAllocator::Segment* BumpAllocator::allocSegment(Segment* prev, size_t size) {
+    PerfCounters::increment(PerfCounter::AllocatorSegments);
+
     auto seg = (Segment*)::operator new(size);
     seg->prev = prev;
     seg->current = (byte*)seg + sizeof(Segment);
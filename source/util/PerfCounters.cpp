@@ -0,0 +1,93 @@
+//------------------------------------------------------------------------------
+// PerfCounters.cpp
+// Lightweight counters for profiling hot paths
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/util/PerfCounters.h"
+
+#include <algorithm>
+#include <atomic>
+#include <fmt/core.h>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace slang {
+
+bool PerfCounters::enabled = false;
+
+namespace {
+
+// The counters owned by a single thread. Only the owning thread ever writes
+// to them, so relaxed loads and stores suffice; they're atomic only so that
+// other threads can read them without a data race.
+struct CounterBlock {
+    std::array<std::atomic<uint64_t>, PerfCounter_traits::values.size()> values{};
+};
+
+// Blocks are owned by the registry rather than by their threads so that
+// counts from threads that have since exited are still reported.
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<CounterBlock>> blocks;
+
+    static Registry& get() {
+        static Registry registry;
+        return registry;
+    }
+};
+
+thread_local CounterBlock* localBlock = nullptr;
+
+} // namespace
+
+void PerfCounters::add(PerfCounter counter, uint64_t amount) {
+    auto block = localBlock;
+    if (!block) {
+        auto& registry = Registry::get();
+        std::scoped_lock lock(registry.mutex);
+        block = registry.blocks.emplace_back(std::make_unique<CounterBlock>()).get();
+        localBlock = block;
+    }
+
+    auto& value = block->values[size_t(counter)];
+    value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+PerfCounters::Values PerfCounters::snapshot() {
+    Values result{};
+    auto& registry = Registry::get();
+    std::scoped_lock lock(registry.mutex);
+    for (auto& block : registry.blocks) {
+        for (size_t i = 0; i < result.size(); i++)
+            result[i] += block->values[i].load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+void PerfCounters::reset() {
+    auto& registry = Registry::get();
+    std::scoped_lock lock(registry.mutex);
+    for (auto& block : registry.blocks) {
+        for (auto& value : block->values)
+            value.store(0, std::memory_order_relaxed);
+    }
+}
+
+void PerfCounters::writeTable(std::ostream& os) {
+    auto values = snapshot();
+
+    size_t width = 0;
+    for (auto counter : PerfCounter_traits::values)
+        width = std::max(width, toString(counter).size());
+
+    for (auto counter : PerfCounter_traits::values) {
+        os << fmt::format("{:<{}}  {:>14}\n", toString(counter), width,
+                          values[size_t(counter)]);
+    }
+}
+
+} // namespace slang
@@ -16,6 +16,7 @@
 
 #include "slang/text/CharInfo.h"
 #include "slang/util/FlatMap.h"
+#include "slang/util/PerfCounters.h"
 
 using namespace std::chrono;
 
@@ -118,6 +119,22 @@ struct TimeTrace::Profiler {
                               escapeString(entry.detail));
         }
 
+        // If hot path counters are enabled, include their final values
+        // as a counter event at the end of the trace.
+        if (PerfCounters::isEnabled()) {
+            auto values = PerfCounters::snapshot();
+            auto endUs = duration_cast<microseconds>(steady_clock::now() - startTime).count();
+            os << fmt::format("{{ \"pid\":1, \"tid\":0, \"ph\":\"C\", \"ts\":{}, "
+                              "\"name\":\"counters\", \"args\":{{ ",
+                              endUs);
+            for (auto counter : PerfCounter_traits::values) {
+                if (counter != PerfCounter_traits::values.front())
+                    os << ", ";
+                os << fmt::format("\"{}\":{}", toString(counter), values[size_t(counter)]);
+            }
+            os << " } },\n";
+        }
+
         // Emit metadata event with process name.
         os << "{ \"cat\":\"\", \"pid\":1, \"tid\":0, \"ts\":0, \"ph\":\"M\", "
               "\"name\":\"process_name\", \"args\":{ \"name\":\"slang\" } }\n";
@@ -196,6 +196,124 @@ TEST_CASE("Driver file preprocess with error") {
     CHECK(stderrContains("unknown macro"));
 }
 
+TEST_CASE("Driver preprocess per unit") {
+    auto guard = OS::captureOutput();
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    // The library file comes first but still inherits macros from the main unit.
+    auto args = fmt::format("testfoo -v \"{0}library/libmod.qv\" \"{0}test.sv\" \"{0}test3.sv\" "
+                            "--single-unit --libraries-inherit-macros -j 4",
+                            findTestDir());
+    CHECK(driver.parseCommandLine(args));
+    CHECK(driver.processOptions());
+    CHECK(driver.runPreprocessorPerUnit({}, false, false, false));
+
+    auto output = OS::capturedStdout;
+    auto libPos = output.find("module qq;");
+    auto mPos = output.find("module m;");
+    auto nPos = output.find("module n(");
+    REQUIRE(libPos != std::string::npos);
+    REQUIRE(mPos != std::string::npos);
+    REQUIRE(nPos != std::string::npos);
+    CHECK(libPos < mPos);
+    CHECK(mPos < nPos);
+}
+
+TEST_CASE("Driver preprocess per unit to output dir") {
+    auto guard = OS::captureOutput();
+
+    std::error_code ec;
+    auto outDir = fs::temp_directory_path(ec) / "slang_pp_units";
+    fs::remove_all(outDir, ec);
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    auto args = fmt::format("testfoo \"{0}test.sv\" \"{0}test2.sv\" \"{0}test3.sv\"",
+                            findTestDir());
+    CHECK(driver.parseCommandLine(args));
+    CHECK(driver.processOptions());
+    CHECK(!driver.runPreprocessorPerUnit(getU8Str(outDir), false, false, false));
+    CHECK(stderrContains("unknown macro"));
+    CHECK(OS::capturedStdout.empty());
+
+    // Units with errors don't leave any output behind.
+    CHECK(fs::exists(outDir / "test.sv"));
+    CHECK(fs::exists(outDir / "test3.sv"));
+    CHECK(!fs::exists(outDir / "test2.sv"));
+
+    std::ifstream file(outDir / "test.sv");
+    std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    CHECK(contents.starts_with("\nmodule m;\n"));
+
+    file.close();
+    fs::remove_all(outDir, ec);
+}
+
+TEST_CASE("Driver preprocess per unit in parallel with inherited macros") {
+    auto guard = OS::captureOutput();
+
+    std::error_code ec;
+    auto dir = fs::temp_directory_path(ec) / "slang_pp_inherit";
+    fs::remove_all(dir, ec);
+    fs::create_directories(dir, ec);
+
+    auto writeFile = [&](const char* name, std::string_view text) {
+        std::ofstream file(dir / name);
+        file << text;
+    };
+
+    writeFile("main.sv", "`define WIDTH 8\nmodule top; endmodule\n");
+    for (int i = 0; i < 4; i++)
+        writeFile(fmt::format("lib{}.v", i).c_str(),
+                  fmt::format("module lib{}; logic [`WIDTH-1:0] a{}; endmodule\n", i, i));
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    // One single unit plus four library units is enough to go down the threaded path.
+    auto args = fmt::format("testfoo -v \"{0}lib0.v\" -v \"{0}lib1.v\" \"{0}main.sv\" "
+                            "-v \"{0}lib2.v\" -v \"{0}lib3.v\" --single-unit "
+                            "--libraries-inherit-macros -j 4",
+                            getU8Str(dir / ""));
+    CHECK(driver.parseCommandLine(args));
+    CHECK(driver.processOptions());
+    CHECK(driver.runPreprocessorPerUnit({}, false, false, false));
+    CHECK(OS::capturedStderr.empty());
+
+    auto output = OS::capturedStdout;
+    CHECK(output.find("module top;") != std::string::npos);
+    for (int i = 0; i < 4; i++)
+        CHECK(output.find(fmt::format("logic [8-1:0] a{};", i)) != std::string::npos);
+
+    fs::remove_all(dir, ec);
+}
+
+TEST_CASE("Driver preprocess per unit reports unwritable output files") {
+    auto guard = OS::captureOutput();
+
+    std::error_code ec;
+    auto outDir = fs::temp_directory_path(ec) / "slang_pp_unwritable";
+    fs::remove_all(outDir, ec);
+
+    // A directory in the way of the output file makes it impossible to open.
+    fs::create_directories(outDir / "test.sv", ec);
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    auto args = fmt::format("testfoo \"{0}test.sv\" \"{0}test3.sv\"", findTestDir());
+    CHECK(driver.parseCommandLine(args));
+    CHECK(driver.processOptions());
+    CHECK(!driver.runPreprocessorPerUnit(getU8Str(outDir), false, false, false));
+    CHECK(stderrContains("unable to write output file"));
+    CHECK(fs::exists(outDir / "test3.sv"));
+
+    fs::remove_all(outDir, ec);
+}
+
 TEST_CASE("Driver report macros") {
     auto guard = OS::captureOutput();
 
@@ -345,6 +463,85 @@ TEST_CASE("Driver parsing with library modules") {
     CHECK(stderrContains("foobaz"));
 }
 
+TEST_CASE("Driver library search directories") {
+    auto guard = OS::captureOutput();
+
+    std::error_code ec;
+    auto dir = fs::temp_directory_path(ec) / "slang_libdirs";
+    fs::remove_all(dir, ec);
+    fs::create_directories(dir / "a", ec);
+    fs::create_directories(dir / "b", ec);
+
+    std::ofstream(dir / "top.sv") << "module top; cell1 c1(); endmodule\n";
+    std::ofstream(dir / "a" / "cell1.qv") << "module cell1; cell2 c2(); Mixed m(); endmodule\n";
+    std::ofstream(dir / "b" / "cell2.v") << "module cell2; endmodule\n";
+    std::ofstream(dir / "b" / "mixed.qv") << "module Mixed; endmodule\n";
+
+    // Whether 'Mixed' resolves to mixed.qv depends on the filesystem.
+    bool caseInsensitive = fs::exists(dir / "b" / "Mixed.qv", ec);
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    auto args = fmt::format("testfoo \"{0}\" -y \"{1}\" -y \"{2}\" --libext .qv",
+                            getU8Str(dir / "top.sv"), getU8Str(dir / "a"),
+                            getU8Str(dir / "b"));
+    CHECK(driver.parseCommandLine(args));
+    CHECK(driver.processOptions());
+    CHECK(driver.parseAllSources());
+    CHECK(driver.syntaxTrees.size() == (caseInsensitive ? 4 : 3));
+
+    fs::remove_all(dir, ec);
+}
+
+TEST_CASE("Driver library search waves are parsed deterministically") {
+    auto guard = OS::captureOutput();
+
+    std::error_code ec;
+    auto dir = fs::temp_directory_path(ec) / "slang_libwaves";
+    fs::remove_all(dir, ec);
+    fs::create_directories(dir / "lib", ec);
+
+    // The first wave has five files, enough to be parsed in parallel, and
+    // one of them pulls in a second wave of two more.
+    std::ofstream(dir / "top.sv") << "module top; w4 a(); w1 b(); w3 c(); w0 d(); w2 e(); "
+                                     "endmodule\n";
+    for (int i = 0; i < 5; i++) {
+        std::ofstream(dir / "lib" / fmt::format("w{}.v", i))
+            << fmt::format("module w{}; {} endmodule\n", i, i == 2 ? "z1 x(); z0 y();" : "");
+    }
+    for (int i = 0; i < 2; i++) {
+        std::ofstream(dir / "lib" / fmt::format("z{}.v", i))
+            << fmt::format("module z{}; endmodule\n", i);
+    }
+
+    auto loadFileNames = [&](const char* threads) {
+        Driver driver;
+        driver.addStandardArgs();
+
+        auto args = fmt::format("testfoo \"{0}\" -y \"{1}\" -j {2}", getU8Str(dir / "top.sv"),
+                                getU8Str(dir / "lib"), threads);
+        CHECK(driver.parseCommandLine(args));
+        CHECK(driver.processOptions());
+        CHECK(driver.parseAllSources());
+
+        std::vector<std::string> names;
+        for (auto& tree : driver.syntaxTrees) {
+            for (auto id : tree->getSourceBufferIds())
+                names.push_back(getU8Str(
+                    fs::path(driver.sourceManager.getRawFileName(id)).filename()));
+        }
+        return names;
+    };
+
+    auto serial = loadFileNames("1");
+    CHECK(serial == std::vector<std::string>{"top.sv", "w0.v", "w1.v", "w2.v", "w3.v", "w4.v",
+                                             "z0.v", "z1.v"});
+    CHECK(loadFileNames("4") == serial);
+
+    fs::remove_all(dir, ec);
+}
+
 TEST_CASE("Driver invalid library module file") {
     auto guard = OS::captureOutput();
 
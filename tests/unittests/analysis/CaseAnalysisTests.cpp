@@ -237,6 +237,21 @@ TEST_CASE("Case Dag Hard Variant") {
         20, {}, {}, {}, false, true);
 }
 
+TEST_CASE("Case Dag Large Decoder") {
+    // An opcode table that decodes the top 10 bits of a 32-bit
+    // instruction word and ignores the rest.
+    std::vector<std::string> clauses;
+    for (uint32_t i = 0; i < 1024; i++)
+        clauses.push_back(fmt::format("{:010b}{}", i, std::string(22, '?')));
+    testDag(clauses, 32);
+
+    // Dropping one of the opcodes leaves a hole, and adding one at the
+    // end that's fully covered makes it unreachable.
+    clauses.erase(clauses.begin() + 0x2a5);
+    clauses.push_back(fmt::format("{:010b}{}", 7, std::string(22, '1')));
+    testDag(clauses, 32, {1023}, "1010100101" + std::string(22, '0'));
+}
+
 TEST_CASE("Inferred latches with 4-state case statements") {
     auto& code = R"(
 module m;
@@ -665,3 +680,23 @@ endmodule
     REQUIRE(diags.size() == 1);
     CHECK(diags[0].code == diag::CaseDup);
 }
+
+TEST_CASE("Case analysis results are shared between identical clause sets") {
+    std::vector<SVInt> clauses;
+    for (uint32_t i = 0; i < 32; i++)
+        clauses.emplace_back(SVInt::fromString(fmt::format("8'b{:05b}???", i)));
+
+    AnalysisManager analysisManager;
+    auto dag1 = analysisManager.getCaseDecisionDag(clauses, 8, false);
+    auto dag2 = analysisManager.getCaseDecisionDag(clauses, 8, false);
+    CHECK(dag1 == dag2);
+    CHECK(dag1->isExhaustive());
+
+    auto dag3 = analysisManager.getCaseDecisionDag(clauses, 8, true);
+    CHECK(dag1 != dag3);
+
+    clauses.pop_back();
+    auto dag4 = analysisManager.getCaseDecisionDag(clauses, 8, false);
+    CHECK(dag1 != dag4);
+    CHECK(!dag4->isExhaustive());
+}
@@ -669,3 +669,45 @@ endmodule
         CHECK(diags[0].code == diag::AlwaysWithoutTimingControl);
     }
 }
+
+TEST_CASE("Inferred latches with many whole and partial assignments") {
+    // Enough variables to span several words of the whole-variable bit set,
+    // mixing whole assignments with partial ones that do and don't add up
+    // to the full variable.
+    constexpr int NumVars = 150;
+    std::string code = "module m(input c);\n";
+    for (int i = 0; i < NumVars; i++)
+        code += fmt::format("    logic [3:0] v{};\n", i);
+
+    code += "    always_comb begin\n        if (c) begin\n";
+    for (int i = 0; i < NumVars; i++)
+        code += fmt::format("            v{} = '0;\n", i);
+
+    code += "        end\n        else begin\n";
+    for (int i = 0; i < NumVars; i++) {
+        if (i == 70)
+            continue;
+
+        if (i == 100 || i == 130) {
+            code += fmt::format("            v{}[1:0] = '0;\n", i);
+            if (i == 100)
+                code += fmt::format("            v{}[3:2] = '1;\n", i);
+        }
+        else {
+            code += fmt::format("            v{} = '1;\n", i);
+        }
+    }
+    code += "        end\n    end\nendmodule\n";
+
+    Compilation compilation;
+    AnalysisManager analysisManager;
+
+    auto [diags, design] = analyze(code, compilation, analysisManager);
+    REQUIRE(diags.size() == 2);
+    CHECK(diags[0].code == diag::InferredLatch);
+    CHECK(diags[1].code == diag::InferredLatch);
+
+    std::string result = report(diags);
+    CHECK(result.find("latch inferred for 'v70'") != std::string::npos);
+    CHECK(result.find("latch inferred for 'v130'") != std::string::npos);
+}
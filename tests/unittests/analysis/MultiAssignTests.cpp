@@ -471,6 +471,65 @@ endmodule
     CHECK(diags[0].code == diag::MultipleAlwaysAssigns);
 }
 
+TEST_CASE("Subroutine drivers and timing reused across many callers") {
+    auto& code = R"(
+module m(input clk);
+    int a, b, c;
+
+    function void setA(int v);
+      a = v;
+    endfunction
+
+    function void setB(int v);
+      b = v;
+    endfunction
+
+    function void both(int v);
+      setA(v);
+      setB(v);
+    endfunction
+
+    function void viaA(int v);
+      setA(v);
+    endfunction
+
+    always_comb begin
+      both(1);
+      viaA(2);
+    end
+
+    function void setC(int v);
+      setA(v);
+      c = v;
+    endfunction
+
+    always_comb setC(1);
+    always_comb setC(2);
+
+    task automatic waitClk;
+      @(posedge clk);
+    endtask
+
+    task automatic helper;
+      waitClk();
+    endtask
+
+    always helper();
+    always begin
+      helper();
+    end
+endmodule
+)";
+
+    Compilation compilation;
+    AnalysisManager analysisManager;
+
+    auto [diags, design] = analyze(code, compilation, analysisManager);
+    REQUIRE(diags.size() == 2);
+    CHECK(diags[0].code == diag::MultipleAlwaysAssigns);
+    CHECK(diags[1].code == diag::MultipleAlwaysAssigns);
+}
+
 TEST_CASE("always_comb dup driver with initial block with language option") {
     auto& code = R"(
 module m;
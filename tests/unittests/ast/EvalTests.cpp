@@ -8,6 +8,7 @@ using Catch::Approx;
 
 #include "slang/ast/ScriptSession.h"
 #include "slang/ast/symbols/CompilationUnitSymbols.h"
+#include "slang/ast/symbols/InstanceSymbols.h"
 #include "slang/ast/symbols/ParameterSymbols.h"
 
 TEST_CASE("Simple eval") {
@@ -2650,3 +2651,84 @@ TEST_CASE("Eval bad statement") {
     ScriptSession session;
     CHECK(!session.eval("fork=L:for"));
 }
+
+TEST_CASE("Script session attached to an existing compilation") {
+    auto tree = SyntaxTree::fromText(R"(
+module m #(parameter int W = 4);
+    localparam int D = W * 2;
+endmodule
+
+module top;
+    m #(.W(8)) inst();
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+
+    auto& inst = compilation.getRoot().lookupName<InstanceSymbol>("top.inst");
+    ScriptSession session(compilation, &inst.body);
+
+    CHECK(session.eval("D + W").integer() == 24);
+    CHECK(session.eval("D + W").integer() == 24);
+    CHECK(session.eval("$bits(D)").integer() == 32);
+
+    NO_SESSION_ERRORS;
+}
+
+TEST_CASE("Script session attached to a compilation evaluates hierarchical names") {
+    auto tree = SyntaxTree::fromText(R"(
+module m #(parameter int W = 4);
+    localparam int D = W * 2;
+endmodule
+
+module top;
+    m #(.W(8)) inst();
+endmodule
+)");
+
+    CompilationOptions co;
+    co.flags |= CompilationFlags::AllowHierarchicalConst;
+    co.languageVersion = LanguageVersion::v1800_2023;
+
+    Bag options;
+    options.set(co);
+
+    Compilation compilation(options);
+    compilation.addSyntaxTree(tree);
+    compilation.getRoot();
+
+    ScriptSession session(compilation);
+    CHECK(session.options.getOrDefault<CompilationOptions>().languageVersion ==
+          LanguageVersion::v1800_2023);
+    CHECK(session.options.getOrDefault<PreprocessorOptions>().languageVersion ==
+          LanguageVersion::v1800_2023);
+
+    CHECK(session.eval("top.inst.D").integer() == 16);
+    CHECK(session.eval("top.inst.D + top.inst.W").integer() == 24);
+
+    NO_SESSION_ERRORS;
+}
+
+TEST_CASE("Script session step limit applies per eval call") {
+    CompilationOptions co;
+    co.maxConstexprSteps = 200;
+
+    Bag options;
+    options.set(co);
+
+    ScriptSession session(std::move(options));
+    session.eval(R"(
+function automatic int sum(int n);
+    int r = 0;
+    for (int i = 0; i < n; i++) r += i;
+    return r;
+endfunction
+)");
+
+    // Each call fits within the limit, but all of them together would not.
+    for (int i = 0; i < 10; i++)
+        CHECK(session.eval("sum(20)").integer() == 190);
+
+    NO_SESSION_ERRORS;
+}
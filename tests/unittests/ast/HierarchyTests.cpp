@@ -4,6 +4,7 @@
 #include "Test.h"
 
 #include "slang/ast/ASTVisitor.h"
+#include "slang/ast/DesignIndex.h"
 #include "slang/ast/symbols/BlockSymbols.h"
 #include "slang/ast/symbols/CompilationUnitSymbols.h"
 #include "slang/ast/symbols/InstanceSymbols.h"
@@ -2172,3 +2173,39 @@ endmodule
     REQUIRE(diags.size() == 1);
     CHECK(diags[0].code == diag::InfinitelyRecursiveHierarchy);
 }
+
+TEST_CASE("Design index") {
+    auto tree = SyntaxTree::fromText(R"(
+module leaf(input logic a, output logic b);
+    always_comb b = ~a;
+endmodule
+
+module top;
+    logic x, y, z;
+    leaf l1(.a(x), .b(y));
+    leaf l2(.a(y), .b(z));
+    initial $display(x + y);
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+    compilation.freeze();
+
+    DesignIndex index(compilation.getRoot());
+    CHECK(index.getSymbols(SymbolKind::Instance).size() == 3);
+    CHECK(index.getSymbols(SymbolKind::Root).size() == 1);
+
+    // The second leaf instance shares a canonical body with the
+    // first, so its contents are only indexed once.
+    CHECK(index.getSymbols(SymbolKind::ProceduralBlock).size() == 2);
+    CHECK(index.getStatements(StatementKind::ExpressionStatement).empty());
+
+    DesignIndex full(compilation.getRoot(),
+                     DesignIndexFlags::Statements | DesignIndexFlags::Expressions);
+    CHECK(full.getSymbols(SymbolKind::Instance).size() == 3);
+    CHECK(full.getStatements(StatementKind::ExpressionStatement).size() == 2);
+    CHECK(full.getExpressions(ExpressionKind::UnaryOp).size() == 1);
+    CHECK(full.getExpressions(ExpressionKind::BinaryOp).size() == 1);
+}
@@ -5,6 +5,7 @@
 
 #include "slang/ast/ASTSerializer.h"
 #include "slang/ast/ASTVisitor.h"
+#include "slang/text/BinaryDocument.h"
 #include "slang/text/Json.h"
 
 std::string serialize(Compilation& comp, bool sourceInfo = false, bool detailedTypeInfo = false,
@@ -1528,3 +1529,258 @@ endmodule : rptr_empty
     compilation.freeze();
     serialize(compilation, false, false, true);
 }
+
+TEST_CASE("Binary document round trip") {
+    auto tree = SyntaxTree::fromText(R"(
+module m #(parameter real R = 1.5, parameter int N = -3)(input logic [N+4:0] a, output b);
+    localparam string S = "some string";
+    assign b = &a;
+    initial $display("%s %d %f", S, N, R);
+endmodule
+
+module top;
+    logic [1:0] a;
+    logic b1, b2;
+    m m1(.a, .b(b1));
+    m m2(.a, .b(b2));
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto serializeTo = [&](DocumentWriter& writer) {
+        ASTSerializer serializer(compilation, writer);
+        serializer.setIncludeAddresses(false);
+        serializer.setIncludeSourceInfo(true);
+        serializer.setDetailedTypeInfo(true);
+        serializer.serialize(compilation.getRoot());
+    };
+
+    JsonWriter expected;
+    serializeTo(expected);
+
+    std::ostringstream stream;
+    {
+        BinaryDocumentWriter binary(stream);
+        serializeTo(binary);
+    }
+
+    auto data = stream.str();
+    CHECK(data.starts_with("SLBD"));
+    CHECK(data.size() < expected.view().size());
+
+    JsonWriter actual;
+    CHECK(BinaryDocumentReader::read(data, actual));
+    CHECK(actual.view() == expected.view());
+
+    // Malformed or truncated input is rejected.
+    JsonWriter sink;
+    CHECK(!BinaryDocumentReader::read("JSON"sv, sink));
+    CHECK(!BinaryDocumentReader::read(std::string_view(data).substr(0, data.size() - 1), sink));
+}
+
+TEST_CASE("Binary document string table is bounded") {
+    auto writeTo = [](DocumentWriter& writer) {
+        writer.startArray();
+        for (size_t i = 0; i < BinaryDocumentWriter::MaxStringTableSize + 100; i++)
+            writer.writeValue("s" + std::to_string(i));
+
+        // Strings already in the table are still referenced,
+        // later ones get written out inline each time.
+        for (size_t i = 0; i < 2; i++) {
+            writer.writeValue("s0"sv);
+            writer.writeValue("s" + std::to_string(BinaryDocumentWriter::MaxStringTableSize + 50));
+        }
+        writer.endArray();
+    };
+
+    JsonWriter expected;
+    writeTo(expected);
+
+    std::ostringstream stream;
+    {
+        BinaryDocumentWriter binary(stream);
+        writeTo(binary);
+    }
+
+    JsonWriter actual;
+    CHECK(BinaryDocumentReader::read(stream.str(), actual));
+    CHECK(actual.view() == expected.view());
+}
+
+TEST_CASE("JSON streaming output") {
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    typedef struct { logic a; int b[3]; } S;
+    S s;
+    initial begin end
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    for (bool pretty : {false, true}) {
+        auto serializeTo = [&](JsonWriter& writer) {
+            writer.setPrettyPrint(pretty);
+
+            ASTSerializer serializer(compilation, writer);
+            serializer.setIncludeAddresses(false);
+            serializer.setDetailedTypeInfo(true);
+            serializer.serialize(compilation.getRoot());
+
+            writer.startObject();
+            writer.endObject();
+            writer.startArray();
+            writer.endArray();
+        };
+
+        JsonWriter expected;
+        serializeTo(expected);
+
+        std::ostringstream stream;
+        JsonWriter streaming(stream);
+        serializeTo(streaming);
+        streaming.flush();
+
+        CHECK(streaming.view().empty());
+        CHECK(stream.str() == expected.view());
+    }
+}
+
+TEST_CASE("Splicing pre-serialized symbols") {
+    auto tree = SyntaxTree::fromText(R"(
+module leaf #(parameter int P)(input logic [P-1:0] a);
+endmodule
+
+module mid;
+    logic [3:0] x;
+    leaf #(4) l1(.a(x));
+    if (1) begin : g
+        leaf #(2) l2(.a(x[1:0]));
+    end
+endmodule
+
+module top;
+    mid m1();
+    mid m2();
+endmodule
+)");
+
+    CompilationOptions options;
+    options.flags |= CompilationFlags::DisableInstanceCaching;
+    Compilation compilation(options);
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto serializeTo = [&](JsonWriter& writer, const Symbol& symbol) {
+        writer.setPrettyPrint(true);
+        ASTSerializer serializer(compilation, writer);
+        serializer.setIncludeAddresses(false);
+        serializer.serialize(symbol, /* inMembersArray */ true);
+    };
+
+    JsonWriter expected;
+    serializeTo(expected, compilation.getRoot());
+
+    // Pre-serialize each of the leaf instances separately and then
+    // splice them into the output of the root.
+    flat_hash_map<const Symbol*, std::string> fragments;
+    for (auto path : {"top.m1.l1", "top.m1.g.l2", "top.m2.l1", "top.m2.g.l2"}) {
+        auto& sym = compilation.getRoot().lookupName<InstanceSymbol>(path);
+        JsonWriter writer;
+        serializeTo(writer, sym);
+        fragments.emplace(&sym, std::string(writer.view()));
+    }
+
+    JsonWriter actual;
+    actual.setPrettyPrint(true);
+    ASTSerializer serializer(compilation, actual);
+    serializer.setIncludeAddresses(false);
+
+    int spliced = 0;
+    serializer.setSymbolOverride([&](const Symbol& symbol) {
+        auto it = fragments.find(&symbol);
+        if (it == fragments.end())
+            return false;
+
+        actual.writeRawValue(it->second);
+        spliced++;
+        return true;
+    });
+    serializer.serialize(compilation.getRoot(), /* inMembersArray */ true);
+
+    CHECK(spliced == 4);
+    CHECK(actual.view() == expected.view());
+}
+
+TEST_CASE("Parallel serialization matches serial output") {
+    auto tree = SyntaxTree::fromText(R"(
+package p;
+    typedef enum logic [1:0] { IDLE, BUSY, DONE } state_t;
+    localparam int W = 4;
+endpackage
+
+module leaf #(parameter int P = 1)(input logic [P-1:0] a, output logic b);
+    enum { X, Y, Z } e;
+    assign b = ^a;
+endmodule
+
+module mid #(parameter int N = 2);
+    import p::*;
+    state_t s;
+    logic [W-1:0] x;
+    logic [3:0] y;
+    leaf #(W) l1(.a(x), .b(y[0]));
+    leaf #(N) arr[2](.a(x[N-1:0]), .b(y[2:1]));
+    for (genvar i = 0; i < N; i++) begin : g
+        leaf #(i + 1) l(.a(x[i:0]), .b());
+    end
+    if (0) begin : never
+        leaf unused(.a(x), .b());
+    end
+endmodule
+
+module top;
+    mid #(2) m1();
+    mid #(3) m2();
+    mid #(2) m3();
+endmodule
+
+module other;
+    leaf l(.a(1'b1), .b());
+endmodule
+)");
+
+    for (bool caching : {true, false}) {
+        CompilationOptions options;
+        if (!caching)
+            options.flags |= CompilationFlags::DisableInstanceCaching;
+
+        Compilation compilation(options);
+        compilation.addSyntaxTree(tree);
+        NO_COMPILATION_ERRORS;
+        compilation.freeze();
+
+        auto serializeTo = [&](uint32_t numThreads) {
+            JsonWriter writer;
+            writer.setPrettyPrint(true);
+
+            ASTSerializer serializer(compilation, writer);
+            serializer.setIncludeAddresses(false);
+            serializer.setIncludeSourceInfo(true);
+            serializer.setTryConstantFold(false);
+            serializer.startArray();
+            serializer.serializeInParallel(compilation.getRoot(), numThreads);
+            serializer.endArray();
+            return std::string(writer.view());
+        };
+
+        auto expected = serializeTo(1);
+        CHECK(serializeTo(2) == expected);
+        CHECK(serializeTo(4) == expected);
+    }
+}
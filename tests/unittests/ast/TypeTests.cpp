@@ -2420,3 +2420,40 @@ endmodule
     REQUIRE(diags.size() == 1);
     CHECK(diags[0].code == diag::EnumCircularBaseType);
 }
+
+TEST_CASE("Array types are interned") {
+    auto tree = SyntaxTree::fromText(R"(
+module m(input logic [3:0][7:0] pa, output int ua[4]);
+    logic [3:0][7:0] pb;
+    int ub[4];
+    int uc[0:3];
+    int ud[5];
+    int da[], db[];
+    int aa[string], ab[string], ac[int];
+    int qa[$], qb[$], qc[$:3];
+    logic [7:0] v1;
+    logic [7:0] v2[2];
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto& m = compilation.getRoot().find<InstanceSymbol>("m").body;
+    auto type = [&](std::string_view name) {
+        return &m.find<ValueSymbol>(name).getType();
+    };
+
+    CHECK(type("pa") == type("pb"));
+    CHECK(type("ua") == type("ub"));
+    CHECK(type("ub") == type("uc"));
+    CHECK(type("ub") != type("ud"));
+    CHECK(type("da") == type("db"));
+    CHECK(type("aa") == type("ab"));
+    CHECK(type("aa") != type("ac"));
+    CHECK(type("qa") == type("qb"));
+    CHECK(type("qa") != type("qc"));
+    CHECK(type("v1") == &compilation.getType(8, IntegralFlags::FourState));
+    CHECK(type("v2")->getArrayElementType() == type("v1"));
+}
@@ -780,3 +780,54 @@ TEST_CASE("Diagnostic warning option corner cases") {
         CHECK(engine.getSeverity(diag::UnknownSystemName, {}) == DiagnosticSeverity::Ignored);
     }
 }
+
+TEST_CASE("Diagnostic coalescing is the same when done in parallel") {
+    // Enough distinct diagnostics to cross the threshold for parallel coalescing,
+    // some of which have arguments that differ between instances and some
+    // of which are only present in some instances.
+    std::string text = "module leaf #(parameter int P);\n";
+    for (int i = 0; i < 1100; i++) {
+        text += fmt::format("    logic [1:0] a{} = 3'd7;\n", i);
+        if (i % 10 == 0)
+            text += fmt::format("    logic [1:0] b{} = 3'(P + 3);\n", i);
+    }
+    text += "    if (P == 1) begin : g\n"
+            "        logic [1:0] c = 4'd15;\n"
+            "    end\n"
+            "endmodule\n"
+            "module mid #(parameter int P);\n"
+            "    leaf #(P) l();\n"
+            "endmodule\n"
+            "module top;\n"
+            "    mid #(1) m1();\n"
+            "    mid #(2) m2();\n"
+            "    mid #(3) m3();\n"
+            "endmodule\n";
+
+    auto tree = SyntaxTree::fromText(text);
+    auto getDiags = [&](uint32_t numThreads) {
+        CompilationOptions options;
+        options.numThreads = numThreads;
+
+        Bag bag;
+        bag.set(options);
+
+        Compilation compilation(bag);
+        compilation.addSyntaxTree(tree);
+
+        auto& diags = compilation.getAllDiagnostics();
+        std::string result = report(diags);
+        for (auto& diag : diags) {
+            result += fmt::format("{} {} {}\n", toString(diag.code),
+                                  diag.coalesceCount.value_or(0),
+                                  diag.symbol ? diag.symbol->getHierarchicalPath() : "");
+        }
+        return std::make_pair(diags.size(), result);
+    };
+
+    auto [count, serial] = getDiags(1);
+    CHECK(count > 1100);
+    CHECK(serial.find("ConstantConversion 1 top.m1.l\n") != std::string::npos);
+    CHECK(serial.find("ConstantConversion 1 top.m2.l\n") != std::string::npos);
+    CHECK(getDiags(4).second == serial);
+}
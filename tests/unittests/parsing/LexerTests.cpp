@@ -1325,6 +1325,45 @@ f
     CHECK(diagnostics.empty());
 }
 
+TEST_CASE("Compact trivia") {
+    LexerOptions options;
+    options.compactTrivia = true;
+
+    auto& sm = getSourceManager();
+    auto buffer = sm.assignText(R"(a   /* comment */ b // comment
+  c /* multi
+line */ d // continued \
+e `define
+)"sv);
+
+    diagnostics.clear();
+    Lexer lexer(buffer, alloc, diagnostics, sm, options);
+
+    CHECK(lexer.lex().trivia().empty());
+
+    auto b = lexer.lex();
+    CHECK(b.isOnSameLine());
+    REQUIRE(b.trivia().size() == 1);
+    CHECK(b.trivia()[0].getRawText() == " ");
+
+    auto c = lexer.lex();
+    CHECK(!c.isOnSameLine());
+    CHECK(c.trivia().size() == 1);
+
+    auto d = lexer.lex();
+    CHECK(!d.isOnSameLine());
+    CHECK(d.trivia().size() == 1);
+
+    // Line comments with a continuation are kept as-is.
+    auto e = lexer.lex();
+    REQUIRE(e.trivia().size() == 3);
+    CHECK(e.trivia()[1].kind == TriviaKind::LineComment);
+
+    CHECK(lexer.lex().kind == TokenKind::Directive);
+    CHECK(lexer.lex().kind == TokenKind::EndOfFile);
+    CHECK(diagnostics.empty());
+}
+
 TEST_CASE("Compat translate_on/off pragmas unclosed") {
     LexerOptions options;
     options.commentHandlers["pragma"]["synthesis_off"] = {CommentHandler::TranslateOff,
@@ -103,6 +103,45 @@ const MemberSyntax* parseModuleMember(const std::string& text, SyntaxKind kind)
     return module.members[0];
 }
 
+TEST_CASE("Netlist style port connections") {
+    auto member = parseModuleMember(
+        "DFF_X1 u1(.D(n1), .CK(clk[0]), .Q(q[3][7:4]), .QN(n2 | n3), .E()), u2(a, b[1], c + d);",
+        SyntaxKind::HierarchyInstantiation);
+
+    auto& insts = member->as<HierarchyInstantiationSyntax>().instances;
+    REQUIRE(insts.size() == 2);
+
+    auto getExpr = [](const PortConnectionSyntax* conn) -> const ExpressionSyntax* {
+        const PropertyExprSyntax* expr;
+        if (conn->kind == SyntaxKind::NamedPortConnection)
+            expr = conn->as<NamedPortConnectionSyntax>().expr;
+        else
+            expr = conn->as<OrderedPortConnectionSyntax>().expr;
+
+        if (!expr || expr->kind != SyntaxKind::SimplePropertyExpr)
+            return nullptr;
+
+        auto& seq = *expr->as<SimplePropertyExprSyntax>().expr;
+        if (seq.kind != SyntaxKind::SimpleSequenceExpr)
+            return nullptr;
+        return seq.as<SimpleSequenceExprSyntax>().expr;
+    };
+
+    auto& named = insts[0]->connections;
+    REQUIRE(named.size() == 5);
+    CHECK(getExpr(named[0])->kind == SyntaxKind::IdentifierName);
+    CHECK(getExpr(named[1])->kind == SyntaxKind::IdentifierSelectName);
+    CHECK(getExpr(named[2])->kind == SyntaxKind::IdentifierSelectName);
+    CHECK(getExpr(named[3])->kind == SyntaxKind::BinaryOrExpression);
+    CHECK(getExpr(named[4]) == nullptr);
+
+    auto& ordered = insts[1]->connections;
+    REQUIRE(ordered.size() == 3);
+    CHECK(getExpr(ordered[0])->kind == SyntaxKind::IdentifierName);
+    CHECK(getExpr(ordered[1])->kind == SyntaxKind::IdentifierSelectName);
+    CHECK(getExpr(ordered[2])->kind == SyntaxKind::AddExpression);
+}
+
 TEST_CASE("Module members") {
     parseModuleMember("Foo #(stuff) bar( .   *), baz(.clock, .rst(rst + 2));",
                       SyntaxKind::HierarchyInstantiation);
@@ -373,6 +373,52 @@ TEST_CASE("Macro stringify whitespace") {
     CHECK_DIAGNOSTICS_EMPTY;
 }
 
+TEST_CASE("Macro stringify with compact trivia") {
+    auto& text = R"(
+`define S `"a    b/*c*/d`"
+`define T(x, y) `"x   y`"
+`define U `"""line1 \
+    line2`"""
+`S `T(p  /* q */, r   s) `U
+)";
+
+    auto stringify = [&](bool compact) {
+        LexerOptions lo;
+        lo.compactTrivia = compact;
+        lo.languageVersion = LanguageVersion::v1800_2023;
+
+        PreprocessorOptions ppo;
+        ppo.languageVersion = LanguageVersion::v1800_2023;
+
+        Bag options;
+        options.set(lo);
+        options.set(ppo);
+
+        diagnostics.clear();
+        Preprocessor preprocessor(getSourceManager(), alloc, diagnostics, options);
+        preprocessor.pushSource(text);
+
+        std::vector<std::string> results;
+        while (true) {
+            Token token = preprocessor.next();
+            if (token.kind == TokenKind::EndOfFile)
+                break;
+            REQUIRE(token.kind == TokenKind::StringLiteral);
+            results.emplace_back(token.valueText());
+        }
+        return results;
+    };
+
+    auto expected = stringify(false);
+    CHECK_DIAGNOSTICS_EMPTY;
+    REQUIRE(expected.size() == 3);
+    CHECK(expected[0] == "a    bd");
+    CHECK(expected[1] == "p   r   s");
+
+    CHECK(stringify(true) == expected);
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
 TEST_CASE("Macro stringify useless concatenation") {
     auto& text = "`define FOO(x) `\"``x`\" \n`FOO(a)";
     Token token = lexToken(text);
@@ -1452,6 +1498,107 @@ TEST_CASE("Command-line defines priority over `define") {
     }
 }
 
+TEST_CASE("Shared macro environment") {
+    PreprocessorOptions ppOptions;
+    ppOptions.predefines.emplace_back("A=2");
+    ppOptions.predefines.emplace_back("B=3");
+    ppOptions.predefines.emplace_back("C");
+    ppOptions.undefines.emplace_back("C");
+
+    Bag options;
+    options.set(ppOptions);
+
+    auto env = MacroEnvironment::create(getSourceManager(), options);
+    CHECK(env->isDefined("A"));
+    CHECK(env->isDefined("__slang__"));
+    CHECK(!env->isDefined("C"));
+    CHECK(env->getDefinedMacros().size() == 20);
+
+    PreprocessorOptions unitOptions;
+    unitOptions.macroEnvironment = env;
+    unitOptions.predefines.emplace_back("A=5");
+    unitOptions.predefines.emplace_back("D=4");
+    options.set(unitOptions);
+
+    auto& text = R"(
+`undef B
+`define E 1
+`ifdef B
+`define BAD
+`endif
+)";
+    diagnostics.clear();
+
+    Preprocessor preprocessor(getSourceManager(), alloc, diagnostics, options);
+    preprocessor.pushSource(text);
+    while (preprocessor.next().kind != TokenKind::EndOfFile) {
+    }
+
+    CHECK(preprocessor.isDefined("A"));
+    CHECK(preprocessor.isDefined("D"));
+    CHECK(preprocessor.isDefined("E"));
+    CHECK(!preprocessor.isDefined("B"));
+    CHECK(!preprocessor.isDefined("BAD"));
+    CHECK(preprocessor.isDefined("__LINE__"));
+
+    auto macros = preprocessor.getDefinedMacros();
+    CHECK(macros.size() == 21);
+    for (auto macro : macros) {
+        if (macro->name.toString() == "A")
+            CHECK(macro->body[0].toString() == "2");
+    }
+
+    // The shared environment is unaffected by the preprocessor.
+    CHECK(env->isDefined("B"));
+    CHECK(!env->isDefined("E"));
+
+    // `undefineall resets back to the environment.
+    preprocessor.pushSource("`undefineall\n");
+    while (preprocessor.next().kind != TokenKind::EndOfFile) {
+    }
+    CHECK(preprocessor.isDefined("B"));
+    CHECK(!preprocessor.isDefined("E"));
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
+TEST_CASE("Shared macro environment with inherited macros") {
+    PreprocessorOptions ppOptions;
+    ppOptions.predefines.emplace_back("A=2");
+
+    Bag options;
+    options.set(ppOptions);
+
+    diagnostics.clear();
+    Preprocessor mainUnit(getSourceManager(), alloc, diagnostics, options);
+    mainUnit.pushSource("`define FROM_MAIN 1\n");
+    while (mainUnit.next().kind != TokenKind::EndOfFile) {
+    }
+
+    PreprocessorOptions libOptions;
+    libOptions.macroEnvironment = MacroEnvironment::create(getSourceManager(), options);
+    options.set(libOptions);
+
+    auto inherited = mainUnit.getDefinedMacros();
+    auto env = MacroEnvironment::create(getSourceManager(), options, inherited);
+    CHECK(env->isDefined("A"));
+    CHECK(env->isDefined("FROM_MAIN"));
+
+    libOptions.macroEnvironment = env;
+    options.set(libOptions);
+
+    Preprocessor preprocessor(getSourceManager(), alloc, diagnostics, options);
+    CHECK(preprocessor.isDefined("FROM_MAIN"));
+
+    // `undefineall removes inherited macros but keeps the predefines.
+    preprocessor.pushSource("`undefineall\n");
+    while (preprocessor.next().kind != TokenKind::EndOfFile) {
+    }
+    CHECK(!preprocessor.isDefined("FROM_MAIN"));
+    CHECK(preprocessor.isDefined("A"));
+    CHECK(preprocessor.isDefined("__slang__"));
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
 TEST_CASE("Undef builtin") {
     auto& text = R"(
 `undef __slang__
@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: MIT
 
 #include "Test.h"
+#include <fmt/format.h>
+#include <sstream>
 
 #include "slang/syntax/SyntaxPrinter.h"
 #include "slang/syntax/SyntaxTree.h"
@@ -265,3 +267,63 @@ endmodule
         CHECK(resultStr.find("SOME_VALUE") == std::string::npos);
     }
 }
+
+TEST_CASE("SyntaxPrinter streaming output") {
+    std::string text;
+    for (int i = 0; i < 5000; i++)
+        text += fmt::format("module m{0}; // comment {0}\n\n\n  wire w{0};\nendmodule\n", i);
+
+    auto tree = SyntaxTree::fromText(text);
+    for (bool squash : {false, true}) {
+        auto expected = SyntaxPrinter().setSquashNewlines(squash).print(*tree).str();
+
+        std::ostringstream stream;
+        SyntaxPrinter printer(stream);
+        printer.setSquashNewlines(squash).print(*tree);
+
+        // Most of the output has already been written out.
+        CHECK(printer.str().size() < expected.size());
+        printer.flush();
+        CHECK(printer.str().empty());
+        CHECK(stream.str() == expected);
+    }
+}
+
+TEST_CASE("SyntaxPrinter line directives") {
+    SourceManager sourceManager;
+    sourceManager.setDisableProximatePaths(true);
+    sourceManager.assignText("inner.svh", "\n  wire b;\n");
+    sourceManager.assignText("outer.svh", "wire a;\n`include \"inner.svh\"\nwire c;\n");
+
+    auto tree = SyntaxTree::fromText(R"(module m;
+`include "outer.svh"
+    wire d;
+endmodule
+)",
+                                     sourceManager, "source.sv");
+
+    std::ostringstream stream;
+    SyntaxPrinter(sourceManager, stream)
+        .setIncludeDirectives(true)
+        .setExpandIncludes(true)
+        .setSquashNewlines(false)
+        .setEmitLineDirectives(true)
+        .print(*tree)
+        .flush();
+
+    CHECK(stream.str() == R"(`line 1 "source.sv" 0
+module m;
+`line 1 "outer.svh" 1
+wire a;
+
+`line 2 "inner.svh" 1
+  wire b;
+
+`line 3 "outer.svh" 2
+wire c;
+
+`line 3 "source.sv" 2
+    wire d;
+endmodule
+)");
+}
@@ -6,6 +6,7 @@
 #include <catch2/matchers/catch_matchers_string.hpp>
 #include <sstream>
 
+#include "slang/util/PerfCounters.h"
 #include "slang/util/Random.h"
 #include "slang/util/TimeTrace.h"
 
@@ -67,4 +68,44 @@ TEST_CASE("TimeTrace tests") {
     TimeTrace::write(sstr);
 }
 
+TEST_CASE("PerfCounters tests") {
+    PerfCounters::reset();
+    PerfCounters::setEnabled(true);
+
+    BS::thread_pool pool(4);
+    for (int i = 0; i < 100; i++) {
+        pool.detach_task([] {
+            PerfCounters::increment(PerfCounter::Lookups);
+            PerfCounters::increment(PerfCounter::ConstantEvalSteps, 2);
+        });
+    }
+    pool.wait();
+
+    auto tree = SyntaxTree::fromText(R"(
+`define FOO(x) x + 1
+module m;
+    localparam int p = `FOO(1) + `FOO(2);
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    PerfCounters::setEnabled(false);
+    PerfCounters::increment(PerfCounter::Lookups);
+
+    auto values = PerfCounters::snapshot();
+    CHECK(values[size_t(PerfCounter::Lookups)] >= 100);
+    CHECK(values[size_t(PerfCounter::ConstantEvalSteps)] >= 200);
+    CHECK(values[size_t(PerfCounter::MacroExpansions)] == 2);
+
+    std::ostringstream sstr;
+    PerfCounters::writeTable(sstr);
+    CHECK_THAT(sstr.str(), ContainsSubstring("MacroExpansions"));
+
+    PerfCounters::reset();
+    CHECK(PerfCounters::snapshot()[size_t(PerfCounter::Lookups)] == 0);
+}
+
 #endif
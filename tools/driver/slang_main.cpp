@@ -7,6 +7,7 @@
 //------------------------------------------------------------------------------
 #include <fstream>
 #include <iostream>
+#include <sstream>
 
 #include "slang/analysis/AnalysisManager.h"
 #include "slang/ast/ASTSerializer.h"
@@ -14,7 +15,9 @@
 #include "slang/ast/symbols/CompilationUnitSymbols.h"
 #include "slang/driver/Driver.h"
 #include "slang/syntax/CSTSerializer.h"
+#include "slang/text/BinaryDocument.h"
 #include "slang/text/Json.h"
+#include "slang/util/PerfCounters.h"
 #include "slang/util/TimeTrace.h"
 #include "slang/util/VersionInfo.h"
 
@@ -23,21 +26,22 @@ using namespace slang::ast;
 using namespace slang::syntax;
 using namespace slang::driver;
 
-void printASTJson(Compilation& compilation, const std::string& fileName,
-                  const std::vector<std::string>& scopes, bool includeSourceInfo,
-                  bool detailedTypes) {
-    JsonWriter writer;
-    writer.setPrettyPrint(true);
-
-    ASTSerializer serializer(compilation, writer);
+void configureSerializer(ASTSerializer& serializer, bool includeSourceInfo, bool detailedTypes) {
     serializer.setIncludeSourceInfo(includeSourceInfo);
     serializer.setDetailedTypeInfo(detailedTypes);
     serializer.setTryConstantFold(false);
+}
 
+void serializeAST(ASTSerializer& serializer, Compilation& compilation,
+                  const std::vector<std::string>& scopes,
+                  std::optional<uint32_t> parallelThreads = {}) {
     if (scopes.empty()) {
         serializer.startObject();
         serializer.writeProperty("design");
-        serializer.serialize(compilation.getRoot());
+        if (parallelThreads)
+            serializer.serializeInParallel(compilation.getRoot(), *parallelThreads);
+        else
+            serializer.serialize(compilation.getRoot());
         serializer.writeProperty("definitions");
         serializer.startArray();
         for (auto def : compilation.getDefinitions())
@@ -52,30 +56,86 @@ void printASTJson(Compilation& compilation, const std::string& fileName,
                 serializer.serialize(*sym);
         }
     }
+}
 
-    writer.writeNewLine();
-    OS::writeFile(fileName, writer.view());
+template<typename TFunc>
+void writeJson(const std::string& fileName, TFunc&& func) {
+    auto write = [&](JsonWriter& writer) {
+        writer.setPrettyPrint(true);
+        func(writer);
+        writer.writeNewLine();
+    };
+
+    if (fileName == "-") {
+        // Standard output may be captured, so go through the OS layer.
+        JsonWriter writer;
+        write(writer);
+        OS::writeFile(fileName, writer.view());
+    }
+    else {
+        // Stream the output so that we never have to hold the entire
+        // document in memory.
+        std::ofstream file(fileName);
+        file.exceptions(std::ios::failbit | std::ios::badbit);
+
+        JsonWriter writer(file);
+        write(writer);
+        writer.flush();
+    }
 }
 
-void printCSTJson(Driver& driver, const std::string& fileName,
-                  CSTJsonMode mode = CSTJsonMode::Full) {
-    JsonWriter writer;
-    writer.setPrettyPrint(true);
+void printASTJson(Compilation& compilation, const std::string& fileName,
+                  const std::vector<std::string>& scopes, bool includeSourceInfo,
+                  bool detailedTypes, std::optional<uint32_t> parallelThreads) {
+    writeJson(fileName, [&](JsonWriter& writer) {
+        ASTSerializer serializer(compilation, writer);
+        configureSerializer(serializer, includeSourceInfo, detailedTypes);
 
-    CSTSerializer converter(writer, mode);
+        // Serializers can only safely run concurrently over a frozen compilation.
+        if (parallelThreads)
+            compilation.freeze();
 
-    writer.startObject();
-    writer.writeProperty("syntaxTrees");
-    writer.startArray();
+        serializeAST(serializer, compilation, scopes, parallelThreads);
+    });
+}
 
-    for (auto& tree : driver.syntaxTrees)
-        converter.serialize(*tree);
+void printASTBinary(Compilation& compilation, const std::string& fileName,
+                    const std::vector<std::string>& scopes, bool includeSourceInfo,
+                    bool detailedTypes) {
+    auto write = [&](std::ostream& stream) {
+        BinaryDocumentWriter writer(stream);
+        ASTSerializer serializer(compilation, writer);
+        configureSerializer(serializer, includeSourceInfo, detailedTypes);
+        serializeAST(serializer, compilation, scopes);
+        writer.flush();
+    };
+
+    if (fileName == "-") {
+        write(std::cout);
+        std::cout.flush();
+    }
+    else {
+        std::ofstream file(fileName, std::ios::binary);
+        file.exceptions(std::ios::failbit | std::ios::badbit);
+        write(file);
+    }
+}
 
-    writer.endArray();
-    writer.endObject();
+void printCSTJson(Driver& driver, const std::string& fileName,
+                  CSTJsonMode mode = CSTJsonMode::Full) {
+    writeJson(fileName, [&](JsonWriter& writer) {
+        CSTSerializer converter(writer, mode);
+
+        writer.startObject();
+        writer.writeProperty("syntaxTrees");
+        writer.startArray();
+
+        for (auto& tree : driver.syntaxTrees)
+            converter.serialize(*tree);
 
-    writer.writeNewLine();
-    OS::writeFile(fileName, writer.view());
+        writer.endArray();
+        writer.endObject();
+    });
 }
 
 template<typename TArgs>
@@ -118,12 +178,28 @@ int driverMain(int argc, TArgs argv) {
         driver.cmdLine.add("--obfuscate-ids", obfuscateIds,
                            "Randomize all identifiers in preprocessed output (with -E)");
 
+        std::optional<bool> preprocessUnits;
+        std::optional<std::string> preprocessDir;
+        driver.cmdLine.add("--preprocess-units", preprocessUnits,
+                           "Preprocess each compilation unit independently, in parallel, "
+                           "instead of as a single stream of text (with -E)");
+        driver.cmdLine.add("--preprocess-dir", preprocessDir,
+                           "Write the preprocessed output of each compilation unit to its own "
+                           "file in the given directory (with -E, implies --preprocess-units)",
+                           "<dir>", CommandLineFlags::FilePath);
+
         std::optional<std::string> astJsonFile;
         driver.cmdLine.add(
             "--ast-json", astJsonFile,
             "Dump the compiled AST in JSON format to the specified file, or '-' for stdout",
             "<file>", CommandLineFlags::FilePath);
 
+        std::optional<std::string> astBinaryFile;
+        driver.cmdLine.add("--ast-binary", astBinaryFile,
+                           "Dump the compiled AST in slang's compact binary document format to "
+                           "the specified file, or '-' for stdout",
+                           "<file>", CommandLineFlags::FilePath);
+
         std::optional<std::string> cstJsonFile;
         driver.cmdLine.add(
             "--cst-json", cstJsonFile,
@@ -140,6 +216,11 @@ int driverMain(int argc, TArgs argv) {
                            "given hierarchical paths",
                            "<path>");
 
+        std::optional<bool> astJsonParallel;
+        driver.cmdLine.add("--ast-json-parallel", astJsonParallel,
+                           "When dumping AST to JSON, serialize independent parts of the design "
+                           "in parallel (subject to --threads)");
+
         std::optional<bool> includeSourceInfo;
         driver.cmdLine.add("--ast-json-source-info", includeSourceInfo,
                            "When dumping AST to JSON, include source line and file information");
@@ -154,6 +235,11 @@ int driverMain(int argc, TArgs argv) {
                            "the results to the given file in Chrome Event Tracing JSON format",
                            "<path>");
 
+        std::optional<bool> perfCounters;
+        driver.cmdLine.add("--perf-counters", perfCounters,
+                           "Count how often various hot paths in the compiler are hit and "
+                           "print a table of the results when finished");
+
         if (!driver.parseCommandLine(argc, argv))
             return 1;
 
@@ -192,9 +278,18 @@ int driverMain(int argc, TArgs argv) {
         if (timeTrace)
             TimeTrace::initialize();
 
+        if (perfCounters == true)
+            PerfCounters::setEnabled(true);
+
         auto runStages = [&]() {
             bool ok = true;
             if (onlyPreprocess == true) {
+                if (preprocessUnits == true || preprocessDir) {
+                    return driver.runPreprocessorPerUnit(preprocessDir, includeComments == true,
+                                                         includeDirectives == true,
+                                                         obfuscateIds == true);
+                }
+
                 return driver.runPreprocessor(includeComments == true, includeDirectives == true,
                                               obfuscateIds == true);
             }
@@ -235,8 +330,18 @@ int driverMain(int argc, TArgs argv) {
 
             if (astJsonFile) {
                 TimeTraceScope timeScope("astSerialization"sv, ""sv);
+                std::optional<uint32_t> parallelThreads;
+                if (astJsonParallel == true)
+                    parallelThreads = driver.options.numThreads.value_or(0);
+
                 printASTJson(*compilation, *astJsonFile, astJsonScopes, includeSourceInfo == true,
-                             serializeDetailedTypes == true);
+                             serializeDetailedTypes == true, parallelThreads);
+            }
+
+            if (astBinaryFile) {
+                TimeTraceScope timeScope("astSerialization"sv, ""sv);
+                printASTBinary(*compilation, *astBinaryFile, astJsonScopes,
+                               includeSourceInfo == true, serializeDetailedTypes == true);
             }
             return ok;
         };
@@ -250,6 +355,12 @@ int driverMain(int argc, TArgs argv) {
             return 4;
         }
 
+        if (perfCounters == true) {
+            std::ostringstream table;
+            PerfCounters::writeTable(table);
+            OS::printE(table.str());
+        }
+
         if (timeTrace) {
             std::ofstream file(*timeTrace);
             TimeTrace::write(file);
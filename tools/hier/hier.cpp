@@ -5,28 +5,235 @@
 // SPDX-FileCopyrightText: Michael Popoloski
 // SPDX-License-Identifier: MIT
 //------------------------------------------------------------------------------
-#include <algorithm>
 #include <regex>
 
-#include "slang/ast/ASTVisitor.h"
 #include "slang/ast/Compilation.h"
+#include "slang/ast/symbols/BlockSymbols.h"
+#include "slang/ast/symbols/CompilationUnitSymbols.h"
 #include "slang/ast/symbols/InstanceSymbols.h"
+#include "slang/ast/symbols/ParameterSymbols.h"
+#include "slang/ast/types/Type.h"
 #include "slang/driver/Driver.h"
+#include "slang/text/SourceManager.h"
 #include "slang/util/VersionInfo.h"
 
 using namespace slang;
 using namespace slang::driver;
 using namespace slang::ast;
 
+namespace {
+
+// Returns true if the hierarchical path @a path is equal to or underneath @a prefix.
+bool isWithin(std::string_view path, std::string_view prefix) {
+    if (!path.starts_with(prefix))
+        return false;
+    if (path.size() == prefix.size())
+        return true;
+
+    auto c = path[prefix.size()];
+    return c == '.' || c == '[';
+}
+
+// Walks the instance hierarchy and prints each instance as soon as it's found.
+// Only instance bodies, instance arrays and generate blocks are ever looked into,
+// and subtrees that can't contain the requested prefix are skipped without
+// being elaborated at all.
+class HierPrinter {
+public:
+    std::optional<std::string> instPrefix;
+    std::optional<std::regex> instRegex;
+    std::optional<std::string> customFormat;
+    std::optional<int> maxDepth;
+    bool params = false;
+    bool collapseArrays = false;
+
+    explicit HierPrinter(const SourceManager& sourceManager) : sourceManager(sourceManager) {}
+
+    void visit(const InstanceSymbol& inst, int depth, bool underPrefix) {
+        if (!inst.isModule())
+            return;
+
+        std::string path;
+        if (!underPrefix && !checkPrefix(inst, path, underPrefix))
+            return;
+
+        print(inst, path, 1);
+        visitBody(inst, depth, underPrefix);
+    }
+
+private:
+    const SourceManager& sourceManager;
+
+    // Checks whether @a symbol is on the way to (or underneath) the instance prefix.
+    // The symbol's path is computed into @a path for reuse by the caller.
+    bool checkPrefix(const Symbol& symbol, std::string& path, bool& underPrefix) const {
+        if (!instPrefix)
+            return underPrefix = true;
+
+        path = symbol.getHierarchicalPath();
+        underPrefix = isWithin(path, *instPrefix);
+        return underPrefix || isWithin(*instPrefix, path);
+    }
+
+    void visitBody(const InstanceSymbol& inst, int depth, bool underPrefix) {
+        // A max depth of zero (or less) means there is no limit.
+        if (maxDepth && *maxDepth > 0 && depth + 1 >= *maxDepth)
+            return;
+
+        visitMembers(inst.body, depth + 1, underPrefix);
+    }
+
+    void visitMembers(const Scope& scope, int depth, bool underPrefix) {
+        for (auto& member : scope.members()) {
+            switch (member.kind) {
+                case SymbolKind::Instance:
+                    visit(member.as<InstanceSymbol>(), depth, underPrefix);
+                    break;
+                case SymbolKind::InstanceArray:
+                    visitArray(member.as<InstanceArraySymbol>(), depth, underPrefix);
+                    break;
+                case SymbolKind::GenerateBlock: {
+                    auto& block = member.as<GenerateBlockSymbol>();
+                    if (block.isUninstantiated)
+                        break;
+
+                    std::string path;
+                    bool childUnderPrefix = underPrefix;
+                    if (underPrefix || checkPrefix(block, path, childUnderPrefix))
+                        visitMembers(block, depth, childUnderPrefix);
+                    break;
+                }
+                case SymbolKind::GenerateBlockArray: {
+                    std::string path;
+                    bool childUnderPrefix = underPrefix;
+                    if (underPrefix || checkPrefix(member, path, childUnderPrefix))
+                        visitMembers(member.as<GenerateBlockArraySymbol>(), depth,
+                                     childUnderPrefix);
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+    }
+
+    void visitArray(const InstanceArraySymbol& array, int depth, bool underPrefix) {
+        std::string path;
+        if (!underPrefix && !checkPrefix(array, path, underPrefix))
+            return;
+
+        // If all of the elements of the array are known to be identical, there's
+        // no point in printing each one; print the array once with a count and
+        // only descend into its first element.
+        if (collapseArrays && underPrefix) {
+            const InstanceSymbol* first = nullptr;
+            size_t count = 0;
+            if (getIdenticalElements(array, first, count)) {
+                if (!first->isModule())
+                    return;
+
+                if (path.empty())
+                    path = array.getHierarchicalPath();
+
+                print(*first, path, count);
+                visitBody(*first, depth, underPrefix);
+                return;
+            }
+        }
+
+        for (auto elem : array.elements) {
+            if (elem->kind == SymbolKind::Instance)
+                visit(elem->as<InstanceSymbol>(), depth, underPrefix);
+            else if (elem->kind == SymbolKind::InstanceArray)
+                visitArray(elem->as<InstanceArraySymbol>(), depth, underPrefix);
+        }
+    }
+
+    // Elements of an array all share the same definition and parameter assignments,
+    // so their bodies are identical unless something (a defparam, bind, or config rule)
+    // targets a specific element, which shows up as a hierarchy override node.
+    static bool getIdenticalElements(const InstanceArraySymbol& array,
+                                     const InstanceSymbol*& first, size_t& count) {
+        for (auto elem : array.elements) {
+            if (elem->kind == SymbolKind::InstanceArray) {
+                if (!getIdenticalElements(elem->as<InstanceArraySymbol>(), first, count))
+                    return false;
+                continue;
+            }
+
+            if (elem->kind != SymbolKind::Instance)
+                return false;
+
+            auto& inst = elem->as<InstanceSymbol>();
+            if (inst.body.hierarchyOverrideNode)
+                return false;
+
+            if (!first)
+                first = &inst;
+            count++;
+        }
+        return first != nullptr;
+    }
+
+    void print(const InstanceSymbol& inst, std::string& path, size_t count) const {
+        if (path.empty())
+            path = inst.getHierarchicalPath();
+
+        if (instRegex && !std::regex_search(path, *instRegex))
+            return;
+
+        auto& def = inst.getDefinition();
+        auto file = sourceManager.getFileName(def.location);
+
+        std::string line;
+        if (customFormat) {
+            line = fmt::format(fmt::runtime(*customFormat), fmt::arg("module", def.name),
+                               fmt::arg("inst", path), fmt::arg("file", file),
+                               fmt::arg("count", count));
+        }
+        else if (count > 1) {
+            line = fmt::format("Module=\"{}\" Instance=\"{}\" Count={} File=\"{}\" ", def.name,
+                               path, count, file);
+        }
+        else {
+            line = fmt::format("Module=\"{}\" Instance=\"{}\" File=\"{}\" ", def.name, path,
+                               file);
+        }
+
+        auto parameters = inst.body.getParameters();
+        if (params && !parameters.empty()) {
+            line += "Parameters: ";
+            for (size_t i = 0; i < parameters.size(); i++) {
+                auto& symbol = parameters[i]->symbol;
+                std::string v;
+                if (symbol.kind == SymbolKind::Parameter)
+                    v = symbol.as<ParameterSymbol>().getValue().toString();
+                else if (symbol.kind == SymbolKind::TypeParameter)
+                    v = symbol.as<TypeParameterSymbol>().targetType.getType().toString();
+                else
+                    v = "?";
+
+                line += fmt::format("{}={}{}", symbol.name, v,
+                                    i + 1 < parameters.size() ? ", " : "");
+            }
+        }
+
+        line.push_back('\n');
+        OS::print(line);
+    }
+};
+
+} // namespace
+
 int main(int argc, char** argv) {
-    std::regex regex;
-    std::smatch match;
     Driver driver;
     driver.addStandardArgs();
 
     std::optional<bool> showHelp;
     std::optional<bool> showVersion;
     std::optional<bool> params;
+    std::optional<bool> collapseArrays;
+    std::optional<bool> allDiags;
     std::optional<int> maxDepth;
     std::optional<std::string> instPrefix;
     std::optional<std::string> instRegex;
@@ -40,10 +247,16 @@ int main(int argc, char** argv) {
                        "<inst-prefix>");
     driver.cmdLine.add("--inst-regex", instRegex,
                        "Show only instances matched by regex (scans whole tree)", "<inst-regex>");
-    driver.cmdLine.add(
-        "--custom-format", customFormat,
-        "Use libfmt-style strings to format output with {inst}, {module}, {file} as argument names",
-        "<fmt::format string>");
+    driver.cmdLine.add("--custom-format", customFormat,
+                       "Use libfmt-style strings to format output with {inst}, {module}, {file}, "
+                       "{count} as argument names",
+                       "<fmt::format string>");
+    driver.cmdLine.add("--collapse-arrays", collapseArrays,
+                       "Print instance arrays whose elements are all identical once, with an "
+                       "instance count, and only descend into their first element");
+    driver.cmdLine.add("--all-diags", allDiags,
+                       "Fully elaborate the design after printing the hierarchy and report all "
+                       "diagnostics, instead of only parse errors");
 
     if (!driver.parseCommandLine(argc, argv))
         return 1;
@@ -65,75 +278,28 @@ int main(int argc, char** argv) {
     bool ok = driver.parseAllSources();
 
     auto compilation = driver.createCompilation();
-    auto sourceManager = compilation->getSourceManager();
-
-    if (instRegex.has_value())
-        regex = instRegex.value();
-    auto instances = compilation->getRoot().topInstances;
-    for (auto& i : instances) {
-        int depth = maxDepth.value_or(-1); // will never be 0, go full depth
-        int pathLength = instPrefix.value_or("").length();
-        int index = 0;
-        i->visit(makeVisitor([&](auto& visitor, const InstanceSymbol& type) {
-            if (type.isModule()) {
-                int len = type.name.length();
-                int save_index = index;
-                // if no instPrefix, pathLength is 0, and this check will never take place, so
-                // instPrefix.value() is safe if index >= pathLength we satisfied the full
-                // instPrefix. from now on we are limited only by max-depth
-                if (index < pathLength) {
-                    if (type.name !=
-                        instPrefix.value().substr(index, std::min(pathLength - index, len))) {
-                        // current instance name did not match
-                        return;
-                    }
-                    index += len;
-                    if (index < pathLength && instPrefix.value()[index] != '.')
-                        return; // separator needed, but didn't find one
-                    index++;    // adjust for '.'
-                }
 
-                auto s_inst = type.getHierarchicalPath();
-                if (!instRegex.has_value() || std::regex_search(s_inst, match, regex)) {
-                    auto s_module = type.getDefinition().name;
-                    auto s_file = sourceManager->getFileName(type.getDefinition().location);
-                    if (customFormat.has_value())
-                        OS::print(fmt::format(fmt::runtime(customFormat.value()),
-                                              fmt::arg("module", s_module),
-                                              fmt::arg("inst", s_inst), fmt::arg("file", s_file)));
-                    else
-                        OS::print(fmt::format("Module=\"{}\" Instance=\"{}\" File=\"{}\" ",
-                                              s_module, s_inst, s_file));
-                    int size = type.body.getParameters().size();
-                    if (size && params.value_or(false)) {
-                        OS::print(fmt::format("Parameters: "));
-                        for (auto p : type.body.getParameters()) {
-                            std::string v;
-                            size--;
-                            if (p->symbol.kind == SymbolKind::Parameter)
-                                v = p->symbol.as<ParameterSymbol>().getValue().toString();
-                            else if (p->symbol.kind == SymbolKind::TypeParameter)
-                                v = p->symbol.as<TypeParameterSymbol>()
-                                        .targetType.getType()
-                                        .toString();
-                            else
-                                v = "?";
-                            OS::print(fmt::format("{}={}{}", p->symbol.name, v, size ? ", " : ""));
-                        }
-                    }
-                    OS::print("\n");
-                }
-                depth--;
-                if (depth)
-                    visitor.visitDefault(type);
-                depth++;
-                index = save_index;
-            }
-        }));
-    }
+    HierPrinter printer(*compilation->getSourceManager());
+    printer.instPrefix = instPrefix;
+    printer.customFormat = customFormat;
+    printer.maxDepth = maxDepth;
+    printer.params = params.value_or(false);
+    printer.collapseArrays = collapseArrays.value_or(false);
+    if (instRegex)
+        printer.instRegex.emplace(*instRegex);
 
-    driver.reportCompilation(*compilation, /* quiet */ false);
-    ok &= driver.reportDiagnostics(/* quiet */ false);
+    // Only the top level instances are created up front; everything
+    // else is elaborated on demand as the printer walks down to it.
+    for (auto inst : compilation->getRoot().topInstances)
+        printer.visit(*inst, 0, /* underPrefix */ false);
+
+    if (allDiags == true) {
+        driver.reportCompilation(*compilation, /* quiet */ false);
+        ok &= driver.reportDiagnostics(/* quiet */ false);
+    }
+    else {
+        ok &= driver.reportParseDiags();
+    }
 
     return ok ? 0 : 3;
 }
@@ -10,10 +10,13 @@
 
 #include "fmt/format.h"
 #include "fmt/ranges.h"
+#include <charconv>
+#include <deque>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <optional>
 #include <ranges>
-#include <sstream>
 #include <vector>
 
 #include "slang/util/Util.h"
@@ -23,7 +26,7 @@ namespace fs = std::filesystem;
 class HppFile {
 public:
     explicit HppFile(const std::string_view name, const bool noSystemC) :
-        fileName(std::string(name) + ".h") {
+        fileName(getFileName(name)) {
         includes.emplace_back("ostream");
         includes.emplace_back("cstddef");
         includes.emplace_back("cstdint");
@@ -33,7 +36,15 @@ public:
             includes.emplace_back("systemc.h");
     }
 
-    void add(std::string&& code) { hpp << code; }
+    void add(std::string_view code) { hpp.append(code); }
+
+    /// Formats the given arguments directly into the file's buffer.
+    template<typename T, typename... Args>
+    void add(fmt::format_string<T, Args...> fmt, T&& arg, Args&&... args) {
+        fmt::format_to(std::back_inserter(hpp), fmt, std::forward<T>(arg),
+                       std::forward<Args>(args)...);
+    }
+
     void addInclude(std::string&& code) {
         if (std::ranges::find(includes, code) == includes.end())
             includes.emplace_back(code);
@@ -42,42 +53,94 @@ public:
         if (std::ranges::find(headers, code) == headers.end())
             headers.emplace_back(code);
     }
-    void addWithIndent(std::string&& code) { hpp << indent(currentIndent) << code; }
+    void addWithIndent(std::string_view code) {
+        addIndent();
+        add(code);
+    }
+
+    template<typename T, typename... Args>
+    void addWithIndent(fmt::format_string<T, Args...> fmt, T&& arg, Args&&... args) {
+        addIndent();
+        add(fmt, std::forward<T>(arg), std::forward<Args>(args)...);
+    }
+
     void increaseIndent() { currentIndent++; }
     void decreaseIndent() {
         SLANG_ASSERT(currentIndent != 0);
         currentIndent--;
     }
 
+    /// Records a hash of the source types this file is generated from, which is
+    /// written into the file so that later runs can tell whether it is up to date.
+    void setSourceHash(uint64_t hash) { sourceHash = hash; }
+
     std::string emit() const {
-        auto includesTransform = std::views::transform(includes, [](const auto& inc) {
-            return fmt::format("#include <{}>", inc);
-        });
-        auto headersTransform = std::views::transform(headers, [](const auto& h) {
-            return fmt::format("#include \"{}.h\"", h);
-        });
-        return fmt::format("// {}\n#pragma once\n\n{}\n{}\n\n{}", fileName,
-                           fmt::join(includesTransform, "\n"), fmt::join(headersTransform, "\n"),
-                           hpp.str());
+        std::string result;
+        emitTo(std::back_inserter(result));
+        return result;
     }
 
     void emitToFile(const fs::path& path) const {
-        auto outFile = std::ofstream(path / fileName);
-        outFile << emit();
+        std::string header;
+        emitHeaderTo(std::back_inserter(header));
+
+        auto outFile = std::ofstream(path / fileName, std::ios::binary);
+        outFile.write(header.data(), std::streamsize(header.size()));
+        outFile.write(hpp.data(), std::streamsize(hpp.size()));
+    }
+
+    /// Reads back the source hash that was written into a previously emitted file,
+    /// if there is one.
+    static std::optional<uint64_t> readSourceHash(const fs::path& path) {
+        std::ifstream file(path);
+        std::string line;
+        if (!std::getline(file, line) || !std::getline(file, line) ||
+            !line.starts_with(SourceHashPrefix)) {
+            return std::nullopt;
+        }
+
+        uint64_t hash = 0;
+        auto str = std::string_view(line).substr(SourceHashPrefix.size());
+        auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), hash, 16);
+        if (ec != std::errc() || ptr != str.data() + str.size())
+            return std::nullopt;
+        return hash;
     }
 
+    static std::string getFileName(std::string_view name) { return std::string(name) + ".h"; }
+
 private:
-    std::stringstream hpp;
+    static constexpr std::string_view SourceHashPrefix = "// slang-reflect-hash: ";
+
+    std::string hpp;
     std::vector<std::string> includes;
     std::vector<std::string_view> headers;
     std::string fileName;
+    std::optional<uint64_t> sourceHash;
     uint32_t currentIndent{0};
 
-    static std::string indent(const uint64_t blocks) {
-        std::string ret;
-        for (auto i = 0; i < blocks * 4; i++)
-            ret += " ";
-        return ret;
+    void addIndent() { hpp.append(currentIndent * 4, ' '); }
+
+    template<typename OutputIt>
+    void emitHeaderTo(OutputIt out) const {
+        out = fmt::format_to(out, "// {}\n", fileName);
+        if (sourceHash)
+            out = fmt::format_to(out, "{}{:016x}\n", SourceHashPrefix, *sourceHash);
+
+        auto includesTransform = std::views::transform(includes, [](const auto& inc) {
+            return fmt::format("#include <{}>", inc);
+        });
+        auto headersTransform = std::views::transform(headers, [](const auto& h) {
+            return fmt::format("#include \"{}.h\"", h);
+        });
+        fmt::format_to(out, "#pragma once\n\n{}\n{}\n\n", fmt::join(includesTransform, "\n"),
+                       fmt::join(headersTransform, "\n"));
+    }
+
+    template<typename OutputIt>
+    void emitTo(OutputIt out) const {
+        emitHeaderTo(out);
+        std::ranges::copy(hpp, out);
     }
 };
 
@@ -85,16 +148,17 @@ class CppEmitter {
 public:
     explicit CppEmitter(const bool noSystemC) : noSystemC(noSystemC) {}
 
+    /// Adds a new file for the given namespace. References to previously
+    /// added files remain valid, so they can be filled in concurrently.
     [[nodiscard]] HppFile& newNamespace(const std::string_view name) {
-        hppFiles.push_back(HppFile(name, noSystemC));
-        return hppFiles.back();
+        return hppFiles.emplace_back(name, noSystemC);
     }
 
     std::string emit() const {
-        std::stringstream ret;
+        std::string ret;
         for (auto& hpp : hppFiles)
-            ret << hpp.emit();
-        return std::move(ret.str());
+            ret += hpp.emit();
+        return ret;
     }
 
     void emitToFile(const fs::path& path) const {
@@ -104,5 +168,5 @@ public:
 
 private:
     bool noSystemC;
-    std::vector<HppFile> hppFiles;
+    std::deque<HppFile> hppFiles;
 };
@@ -14,9 +14,15 @@
 
 class SvTypeReflector {
 public:
+    /// Code for different namespaces is generated concurrently using @a numThreads
+    /// threads (0 means one per hardware thread). If @a incrementalDir is set,
+    /// namespaces whose header in that directory was generated from the same
+    /// source types are not generated again.
     explicit SvTypeReflector(std::unique_ptr<slang::ast::Compilation> compilation,
-                             const bool verbose, const bool noSystemC) :
-        verbose(verbose), noSystemC(noSystemC), cppEmitter(noSystemC),
+                             const bool verbose, const bool noSystemC, uint32_t numThreads = 1,
+                             std::optional<fs::path> incrementalDir = {}) :
+        verbose(verbose), noSystemC(noSystemC), numThreads(numThreads),
+        incrementalDir(std::move(incrementalDir)), cppEmitter(noSystemC),
         compilation(std::move(compilation)) {}
 
     void reflect();
@@ -27,6 +33,8 @@ public:
 private:
     bool verbose;
     bool noSystemC;
+    uint32_t numThreads;
+    std::optional<fs::path> incrementalDir;
     CppEmitter cppEmitter;
     std::unique_ptr<slang::ast::Compilation> compilation;
 };
@@ -19,10 +19,10 @@ void SvEnum::toCpp(HppFile& hppFile, std::string_view, const SvAliases&, bool) c
             std::runtime_error("Enum with $bits size bigger than 64 bits are not supported"));
     };
     //** STRUCT (ENUM) DECLARATION **//
-    hppFile.addWithIndent(fmt::format("struct {} {{\n", type.name));
+    hppFile.addWithIndent("struct {} {{\n", type.name);
     hppFile.increaseIndent();
 
-    hppFile.addWithIndent(fmt::format("enum Type : {} {{\n", underlyingType()));
+    hppFile.addWithIndent("enum Type : {} {{\n", underlyingType());
     hppFile.increaseIndent();
 
     std::vector<std::pair<std::string, uint64_t>> members;
@@ -36,7 +36,7 @@ void SvEnum::toCpp(HppFile& hppFile, std::string_view, const SvAliases&, bool) c
 
     //** MEMBERS DECLARATION **//
     for (auto i = 0; i < members.size(); i++) {
-        hppFile.addWithIndent(fmt::format("{} = {}", members[i].first, members[i].second));
+        hppFile.addWithIndent("{} = {}", members[i].first, members[i].second);
         if (i == members.size() - 1)
             hppFile.add("\n");
         else
@@ -46,38 +46,37 @@ void SvEnum::toCpp(HppFile& hppFile, std::string_view, const SvAliases&, bool) c
     hppFile.addWithIndent("};\n\n");
 
     //** SIZE **/
-    hppFile.addWithIndent(
-        fmt::format("static constexpr size_t _size = {};\n\n", type.getBitstreamWidth()));
+    hppFile.addWithIndent("static constexpr size_t _size = {};\n\n", type.getBitstreamWidth());
 
     //** LOCAL **//
     hppFile.addWithIndent("Type type;\n");
 
     //** DEFAULT CONSTRUCTOR **//
-    hppFile.addWithIndent(fmt::format("{}() = default;\n", type.name));
+    hppFile.addWithIndent("{}() = default;\n", type.name);
 
     //** CONSTRUCTOR **//
-    hppFile.addWithIndent(fmt::format("{} ({} __data) {{\n", type.name, underlyingType()));
+    hppFile.addWithIndent("{} ({} __data) {{\n", type.name, underlyingType());
     hppFile.increaseIndent();
     hppFile.addWithIndent("switch (__data) {\n");
     hppFile.increaseIndent();
     for (const auto& [name, value] : members)
-        hppFile.addWithIndent(fmt::format("case {}: type = Type::{}; break;\n", value, name));
+        hppFile.addWithIndent("case {}: type = Type::{}; break;\n", value, name);
     hppFile.decreaseIndent();
     hppFile.addWithIndent("}\n");
     hppFile.decreaseIndent();
     hppFile.addWithIndent("}\n\n");
 
     //** CONSTRUCTOR FROM ENUM **//
-    hppFile.addWithIndent(fmt::format("{0} (Type& type) {{ this->type = type; }}\n", type.name));
+    hppFile.addWithIndent("{0} (Type& type) {{ this->type = type; }}\n", type.name);
 
     //** OVERLOAD << OPERATOR **//
-    hppFile.addWithIndent(fmt::format(
-        "friend std::ostream& operator<<(std::ostream& os, const {}& __data) {{\n", type.name));
+    hppFile.addWithIndent(
+        "friend std::ostream& operator<<(std::ostream& os, const {}& __data) {{\n", type.name);
     hppFile.increaseIndent();
     hppFile.addWithIndent("switch (__data.type) {\n");
     hppFile.increaseIndent();
     for (const auto& name : members | std::views::keys)
-        hppFile.addWithIndent(fmt::format("case Type::{0}: os << \"{0}\"; break;\n", name));
+        hppFile.addWithIndent("case Type::{0}: os << \"{0}\"; break;\n", name);
     hppFile.decreaseIndent();
     hppFile.addWithIndent("}\n");
     hppFile.addWithIndent("return os;\n");
@@ -85,7 +84,7 @@ void SvEnum::toCpp(HppFile& hppFile, std::string_view, const SvAliases&, bool) c
     hppFile.addWithIndent("}\n\n");
 
     //** OVERLOAD = OPERATOR **//
-    hppFile.addWithIndent(fmt::format("{}& operator=(const Type t) {{\n", type.name));
+    hppFile.addWithIndent("{}& operator=(const Type t) {{\n", type.name);
     hppFile.increaseIndent();
     hppFile.addWithIndent("this->type = t;\n");
     hppFile.addWithIndent("return *this;\n");
@@ -95,7 +94,7 @@ void SvEnum::toCpp(HppFile& hppFile, std::string_view, const SvAliases&, bool) c
     //** OVERLOAD UINT64_T OPERATOR **//
     hppFile.addWithIndent(fmt::format("operator uint64_t() const {{\n"));
     hppFile.increaseIndent();
-    hppFile.addWithIndent(fmt::format("return static_cast<uint64_t>(type);\n", type.name));
+    hppFile.addWithIndent("return static_cast<uint64_t>(type);\n", type.name);
     hppFile.decreaseIndent();
     hppFile.addWithIndent("}\n\n");
 
@@ -53,16 +53,15 @@ void SvLocalParam::toCpp(HppFile& hppFile, std::string_view, const SvAliases&, b
             arrayType = fmt::format("std::array<{}, {}", arrayType, arraySize);
         for (auto i = 1; i < unpackedArrays.size(); i++)
             arrayType += ">";
-        hppFile.addWithIndent(
-            fmt::format("static constexpr {} {} = {{{{\n", arrayType, parameterName));
+        hppFile.addWithIndent("static constexpr {} {} = {{{{\n", arrayType, parameterName);
         hppFile.increaseIndent();
         for (const auto& unpacked : unpackedArrays) {
             hppFile.addWithIndent("{{");
             for (auto i = 0; i < unpacked.size(); i++) {
                 if (i == 0)
-                    hppFile.add(fmt::format(" {:#x}", unpacked[i]));
+                    hppFile.add(" {:#x}", unpacked[i]);
                 else
-                    hppFile.add(fmt::format(", {:#x}", unpacked[i]));
+                    hppFile.add(", {:#x}", unpacked[i]);
             }
             hppFile.add(" }},\n");
         }
@@ -70,10 +69,9 @@ void SvLocalParam::toCpp(HppFile& hppFile, std::string_view, const SvAliases&, b
         hppFile.addWithIndent("}};\n");
     }
     else if (parameter.getValue().isInteger()) {
-        hppFile.addWithIndent(
-            fmt::format("static constexpr {} {} = {};\n",
-                        toString(CppType::fromSize(parameter.getType().getBitstreamWidth())),
-                        parameterName, *parameter.getValue().integer().getRawPtr()));
+        hppFile.addWithIndent("static constexpr {} {} = {};\n",
+                              toString(CppType::fromSize(parameter.getType().getBitstreamWidth())),
+                              parameterName, *parameter.getValue().integer().getRawPtr());
     }
     else {
         SLANG_THROW(
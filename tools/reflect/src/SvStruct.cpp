@@ -13,7 +13,7 @@ void SvStruct::toCpp(HppFile& hppFile, const std::string_view _namespace, const
     //* STRUCT DECLARATION **/
     auto structName = isCppReserved(type.name) ? fmt::format("_{}", type.name)
                                                : std::string(type.name);
-    hppFile.addWithIndent(fmt::format("struct {} {{\n", structName));
+    hppFile.addWithIndent("struct {} {{\n", structName);
     hppFile.increaseIndent();
 
     std::vector<std::pair<std::string, SvType>> members;
@@ -46,12 +46,11 @@ void SvStruct::toCpp(HppFile& hppFile, const std::string_view _namespace, const
     //** MEMBERS DECLARATION **//
     for (const auto& [name, type] : members) {
         if (type.isStructEnumOrUnion() && _namespace != type._namespace) {
-            hppFile.addWithIndent(
-                fmt::format("{}::{} {};\n", type._namespace, type.toString(), name));
+            hppFile.addWithIndent("{}::{} {};\n", type._namespace, type.toString(), name);
             hppFile.addIncludeHeader(type._namespace);
         }
         else {
-            hppFile.addWithIndent(fmt::format("{} {};\n", type.toString(), name));
+            hppFile.addWithIndent("{} {};\n", type.toString(), name);
         }
     }
     hppFile.add("\n");
@@ -59,21 +58,21 @@ void SvStruct::toCpp(HppFile& hppFile, const std::string_view _namespace, const
     //** GENERATE START AND WIDTH OF EACH SIGNAL **//
     size_t startBit = 0;
     for (const auto& [name, type] : members) {
-        hppFile.addWithIndent(fmt::format("static constexpr size_t {}_s = {};\n", name, startBit));
-        hppFile.addWithIndent(fmt::format("static constexpr size_t {}_w = {};\n", name, type.size));
+        hppFile.addWithIndent("static constexpr size_t {}_s = {};\n", name, startBit);
+        hppFile.addWithIndent("static constexpr size_t {}_w = {};\n", name, type.size);
         startBit += type.size;
     }
-    hppFile.addWithIndent(fmt::format("static constexpr size_t _size = {};\n", structSize));
+    hppFile.addWithIndent("static constexpr size_t _size = {};\n", structSize);
     hppFile.add("\n");
 
     //** GENERATE DEFAULT CONSTRUCTOR **//
-    hppFile.addWithIndent(fmt::format("{}() = default;\n\n", structName));
+    hppFile.addWithIndent("{}() = default;\n\n", structName);
 
     //** GENERATE CONSTRUCTOR **//
     {
-        hppFile.addWithIndent(fmt::format("{}(", structName));
+        hppFile.addWithIndent("{}(", structName);
 
-        hppFile.add(fmt::format("const {}& __data) {{\n", cppTypeStr));
+        hppFile.add("const {}& __data) {{\n", cppTypeStr);
 
         hppFile.increaseIndent();
 
@@ -103,13 +102,12 @@ void SvStruct::toCpp(HppFile& hppFile, const std::string_view _namespace, const
 
             if (type.isStructEnumOrUnion())
                 if (_namespace != type._namespace)
-                    hppFile.addWithIndent(fmt::format("{} = {}::{}({});\n", name, type._namespace,
-                                                      type.toString(), value));
+                    hppFile.addWithIndent("{} = {}::{}({});\n", name, type._namespace,
+                                          type.toString(), value);
                 else
-                    hppFile.addWithIndent(
-                        fmt::format("{} = {}({});\n", name, type.toString(), value));
+                    hppFile.addWithIndent("{} = {}({});\n", name, type.toString(), value);
             else
-                hppFile.addWithIndent(fmt::format("{} = {};\n", name, value));
+                hppFile.addWithIndent("{} = {};\n", name, value);
         }
 
         hppFile.decreaseIndent();
@@ -120,8 +118,8 @@ void SvStruct::toCpp(HppFile& hppFile, const std::string_view _namespace, const
     // Note: This constructor will be generated only if the other constructor is not already from a
     // sc_bv
     if (!noSystemC && structSize <= 64) {
-        hppFile.addWithIndent(
-            fmt::format("{}(const sc_bv<{}>& __data) {{\n", structName, type.getBitstreamWidth()));
+        hppFile.addWithIndent("{}(const sc_bv<{}>& __data) {{\n", structName,
+                              type.getBitstreamWidth());
 
         hppFile.increaseIndent();
 
@@ -134,13 +132,12 @@ void SvStruct::toCpp(HppFile& hppFile, const std::string_view _namespace, const
 
             if (type.isStructEnumOrUnion())
                 if (_namespace != type._namespace)
-                    hppFile.addWithIndent(fmt::format("{} = {}::{}({});\n", name, type._namespace,
-                                                      type.toString(), value));
+                    hppFile.addWithIndent("{} = {}::{}({});\n", name, type._namespace,
+                                          type.toString(), value);
                 else
-                    hppFile.addWithIndent(
-                        fmt::format("{} = {}({});\n", name, type.toString(), value));
+                    hppFile.addWithIndent("{} = {}({});\n", name, type.toString(), value);
             else
-                hppFile.addWithIndent(fmt::format("{} = {};\n", name, value));
+                hppFile.addWithIndent("{} = {};\n", name, value);
         }
 
         hppFile.decreaseIndent();
@@ -149,30 +146,29 @@ void SvStruct::toCpp(HppFile& hppFile, const std::string_view _namespace, const
 
     //** GENERATE SERIALIZER **//
     if (cppType == CppType::SC_BV) {
-        hppFile.addWithIndent(fmt::format("operator {}() const {{\n", cppTypeStr));
+        hppFile.addWithIndent("operator {}() const {{\n", cppTypeStr);
         hppFile.increaseIndent();
-        hppFile.addWithIndent(fmt::format("auto ret = {}();\n", cppTypeStr));
+        hppFile.addWithIndent("auto ret = {}();\n", cppTypeStr);
         for (const auto& [name, type] : members) {
             if (type.cppType == CppType::BOOL) {
-                hppFile.addWithIndent(fmt::format("ret.set_bit({0}_s, {0});\n", name));
+                hppFile.addWithIndent("ret.set_bit({0}_s, {0});\n", name);
             }
             else {
-                hppFile.addWithIndent(fmt::format("ret.range({0}_s + {0}_w - 1, {0}_s) = ", name));
+                hppFile.addWithIndent("ret.range({0}_s + {0}_w - 1, {0}_s) = ", name);
                 if (type.isStructEnumOrUnion() && type.size > 64)
-                    hppFile.add(fmt::format("sc_bv<{}>({});\n", type.size, name));
+                    hppFile.add("sc_bv<{}>({});\n", type.size, name);
                 else
-                    hppFile.add(fmt::format("{};\n", name));
+                    hppFile.add("{};\n", name);
             }
         }
         hppFile.addWithIndent("return ret;\n");
     }
     else {
-        hppFile.addWithIndent(fmt::format("operator {}() const {{\n", cppTypeStr));
+        hppFile.addWithIndent("operator {}() const {{\n", cppTypeStr);
         hppFile.increaseIndent();
-        hppFile.addWithIndent(fmt::format("{} ret = 0;\n", cppTypeStr));
+        hppFile.addWithIndent("{} ret = 0;\n", cppTypeStr);
         for (const auto& name : members | std::views::keys) {
-            hppFile.addWithIndent(
-                fmt::format("ret |= static_cast<{0}>({1}) << {1}_s;\n", cppTypeStr, name));
+            hppFile.addWithIndent("ret |= static_cast<{0}>({1}) << {1}_s;\n", cppTypeStr, name);
         }
         hppFile.addWithIndent("return ret;\n");
     }
@@ -181,19 +177,19 @@ void SvStruct::toCpp(HppFile& hppFile, const std::string_view _namespace, const
 
     //** GENERATE BV SERIALIZER **//
     if (!noSystemC && cppType != CppType::SC_BV) {
-        hppFile.addWithIndent(fmt::format("operator sc_bv<{}>() const {{\n", structSize));
+        hppFile.addWithIndent("operator sc_bv<{}>() const {{\n", structSize);
         hppFile.increaseIndent();
-        hppFile.addWithIndent(fmt::format("auto ret = sc_bv<{}>();\n", structSize));
+        hppFile.addWithIndent("auto ret = sc_bv<{}>();\n", structSize);
         for (const auto& [name, type] : members) {
             if (type.cppType == CppType::BOOL) {
-                hppFile.addWithIndent(fmt::format("ret.set_bit({0}_s, {0});\n", name));
+                hppFile.addWithIndent("ret.set_bit({0}_s, {0});\n", name);
             }
             else {
-                hppFile.addWithIndent(fmt::format("ret.range({0}_s + {0}_w - 1, {0}_s) = ", name));
+                hppFile.addWithIndent("ret.range({0}_s + {0}_w - 1, {0}_s) = ", name);
                 if (type.isStructEnumOrUnion() && type.size > 64)
-                    hppFile.add(fmt::format("sc_bv<{}>({});\n", type.size, name));
+                    hppFile.add("sc_bv<{}>({});\n", type.size, name);
                 else
-                    hppFile.add(fmt::format("{};\n", name));
+                    hppFile.add("{};\n", name);
             }
         }
         hppFile.addWithIndent("return ret;\n");
@@ -208,14 +204,14 @@ void SvStruct::toCpp(HppFile& hppFile, const std::string_view _namespace, const
     bool first = true;
     for (const auto& [name, type] : members) {
         if (first)
-            hppFile.addWithIndent(fmt::format("ss << \"{0}\" << \" = \" << ", name));
+            hppFile.addWithIndent("ss << \"{0}\" << \" = \" << ", name);
         else
-            hppFile.addWithIndent(fmt::format("ss << \" {0}\" << \" = \" << ", name));
+            hppFile.addWithIndent("ss << \" {0}\" << \" = \" << ", name);
 
         if (type.cppType == CppType::SC_BV || type.cppType == CppType::STRUCT)
-            hppFile.add(fmt::format("{0}.to_string();\n", name));
+            hppFile.add("{0}.to_string();\n", name);
         else
-            hppFile.add(fmt::format("{0};\n", name));
+            hppFile.add("{0};\n", name);
 
         first = false;
     }
@@ -224,8 +220,8 @@ void SvStruct::toCpp(HppFile& hppFile, const std::string_view _namespace, const
     hppFile.addWithIndent("}\n\n");
 
     //* OVERLOAD << OPERATOR *//
-    hppFile.addWithIndent(fmt::format(
-        "friend std::ostream& operator<<(std::ostream& os, const {}& __data) {{\n", structName));
+    hppFile.addWithIndent(
+        "friend std::ostream& operator<<(std::ostream& os, const {}& __data) {{\n", structName);
     hppFile.increaseIndent();
     hppFile.addWithIndent("os << __data.to_string();\n");
     hppFile.addWithIndent("return os;\n");
@@ -235,12 +231,12 @@ void SvStruct::toCpp(HppFile& hppFile, const std::string_view _namespace, const
     //* STATIC GET FUNCTIONS *//
     for (const auto& [name, type] : members) {
         if (type.isStructEnumOrUnion() && _namespace != type._namespace) {
-            hppFile.addWithIndent(fmt::format("static {}::{} get_{} (const {}& __data) {{\n",
-                                              type._namespace, type.toString(), name, cppTypeStr));
+            hppFile.addWithIndent("static {}::{} get_{} (const {}& __data) {{\n", type._namespace,
+                                  type.toString(), name, cppTypeStr);
         }
         else {
-            hppFile.addWithIndent(fmt::format("static {} get_{} (const {}& __data) {{\n",
-                                              type.toString(), name, cppTypeStr));
+            hppFile.addWithIndent("static {} get_{} (const {}& __data) {{\n", type.toString(), name,
+                                  cppTypeStr);
         }
         hppFile.increaseIndent();
         std::string value;
@@ -258,12 +254,12 @@ void SvStruct::toCpp(HppFile& hppFile, const std::string_view _namespace, const
 
         if (type.isStructEnumOrUnion())
             if (_namespace != type._namespace)
-                hppFile.addWithIndent(
-                    fmt::format("return {}::{}({});\n", type._namespace, type.toString(), value));
+                hppFile.addWithIndent("return {}::{}({});\n", type._namespace, type.toString(),
+                                      value);
             else
-                hppFile.addWithIndent(fmt::format("return {}({});\n", type.toString(), value));
+                hppFile.addWithIndent("return {}({});\n", type.toString(), value);
         else
-            hppFile.addWithIndent(fmt::format("return {};\n", value));
+            hppFile.addWithIndent("return {};\n", value);
 
         hppFile.decreaseIndent();
         hppFile.addWithIndent("}\n");
@@ -12,6 +12,11 @@
 #include "fmt/color.h"
 
 #include "slang/util/OS.h"
+#include "slang/util/VersionInfo.h"
+
+#if defined(SLANG_USE_THREADS)
+#    include <BS_thread_pool.hpp>
+#endif
 
 using namespace slang;
 using namespace ast;
@@ -35,19 +40,28 @@ void SvTypeReflector::reflect() {
     struct namespaceMembers {
         std::vector<std::unique_ptr<SvGeneric>> members;
         SvAliases aliases;
+        size_t sourceHash = 0;
     };
     std::unordered_map<std::string_view, namespaceMembers> namespaces;
 
+    // In incremental mode, everything the generated code depends on is hashed
+    // so that we can tell later whether a namespace needs to be regenerated.
+    auto hashSource = [&](namespaceMembers& ns, const Symbol& symbol, const auto&... extra) {
+        if (incrementalDir)
+            hash_combine(ns.sourceHash, symbol.getSyntax()->toString(), extra...);
+    };
+
     compilation->getRoot().visit(makeVisitor([&](auto&, const TypeAliasType& type) {
         if (checkPublic(type, parsing::TokenKind::Semicolon)) {
+            auto& ns = namespaces[getNamespace(type)];
             if (type.isStruct())
-                namespaces[getNamespace(type)].members.emplace_back(
-                    std::make_unique<SvStruct>(type));
+                ns.members.emplace_back(std::make_unique<SvStruct>(type));
             else if (type.isEnum())
-                namespaces[getNamespace(type)].members.emplace_back(std::make_unique<SvEnum>(type));
+                ns.members.emplace_back(std::make_unique<SvEnum>(type));
             else if (type.isUnion())
-                namespaces[getNamespace(type)].members.emplace_back(
-                    std::make_unique<SvUnion>(type));
+                ns.members.emplace_back(std::make_unique<SvUnion>(type));
+
+            hashSource(ns, type, type.getCanonicalType().toString(), type.getBitstreamWidth());
             if (verbose)
                 OS::print(fg(fmt::color::yellow_green),
                           fmt::format("Detected {} as public\n", type.name));
@@ -59,40 +73,90 @@ void SvTypeReflector::reflect() {
 
     compilation->getRoot().visit(makeVisitor([&](auto&, const ParameterSymbol& type) {
         if (type.isLocalParam() && checkPublic(type, parsing::TokenKind::Equals)) {
-            namespaces[getNamespace(type)].members.emplace_back(
-                std::make_unique<SvLocalParam>(type));
+            auto& ns = namespaces[getNamespace(type)];
+            ns.members.emplace_back(std::make_unique<SvLocalParam>(type));
+
+            hashSource(ns, type, type.getValue().toString());
             if (verbose)
                 OS::print(fg(fmt::color::yellow_green),
                           fmt::format("Detected {} as public\n", type.name));
         }
     }));
 
-    for (const auto& [namespaceName, namespaceMembers] : namespaces) {
-        if (namespaceMembers.members.empty())
-            continue;
+    // Generate namespaces in a stable order so that output doesn't depend on hashing.
+    std::vector<std::pair<std::string_view, const namespaceMembers*>> sortedNamespaces;
+    for (auto& [namespaceName, ns] : namespaces) {
+        if (!ns.members.empty())
+            sortedNamespaces.emplace_back(namespaceName, &ns);
+    }
+    std::ranges::sort(sortedNamespaces, {}, [](auto& entry) { return entry.first; });
+
+    struct GenerateJob {
+        std::string_view namespaceName;
+        const namespaceMembers* ns;
+        HppFile* hpp;
+    };
+    std::vector<GenerateJob> jobs;
+
+    for (auto [namespaceName, ns] : sortedNamespaces) {
+        std::optional<size_t> sourceHash;
+        if (incrementalDir) {
+            // Aliases are unordered, so combine them in an order-independent way.
+            size_t hash = ns->sourceHash;
+            size_t aliasesHash = 0;
+            for (auto& [name, target] : ns->aliases) {
+                size_t aliasHash = 0;
+                hash_combine(aliasHash, name, target);
+                aliasesHash += aliasHash;
+            }
+            hash_combine(hash, aliasesHash, noSystemC, VersionInfo::getHash());
+
+            auto path = *incrementalDir / HppFile::getFileName(namespaceName);
+            if (HppFile::readSourceHash(path) == hash) {
+                if (verbose)
+                    OS::print(fg(fmt::color::yellow_green),
+                              fmt::format("Skipping {}, it is up to date\n", namespaceName));
+                continue;
+            }
+            sourceHash = hash;
+        }
 
-        //** NAMESPACE DECLARATION **//
         auto& hpp = cppEmitter.newNamespace(namespaceName);
-        hpp.add(fmt::format("namespace {} {{\n", namespaceName));
-        hpp.increaseIndent();
+        if (sourceHash)
+            hpp.setSourceHash(*sourceHash);
+        jobs.push_back({namespaceName, ns, &hpp});
+    }
+
+    auto generate = [&](size_t index) {
+        auto& [namespaceName, ns, hpp] = jobs[index];
+
+        //** NAMESPACE DECLARATION **//
+        hpp->add("namespace {} {{\n", namespaceName);
+        hpp->increaseIndent();
 
         //** NAMESPACE MEMBERS DECLARATION **//
-        for (const auto& generic : namespaceMembers.members) {
-            if (generic->isStruct())
-                reinterpret_cast<SvStruct*>(generic.get())
-                    ->toCpp(hpp, namespaceName, namespaceMembers.aliases, noSystemC);
-            else if (generic->isEnum())
-                reinterpret_cast<SvEnum*>(generic.get())
-                    ->toCpp(hpp, namespaceName, namespaceMembers.aliases, noSystemC);
-            else if (generic->isUnion())
-                reinterpret_cast<SvUnion*>(generic.get())
-                    ->toCpp(hpp, namespaceName, namespaceMembers.aliases, noSystemC);
-            else if (generic->isLocalParam())
-                reinterpret_cast<SvLocalParam*>(generic.get())
-                    ->toCpp(hpp, namespaceName, namespaceMembers.aliases, noSystemC);
-        }
+        for (const auto& generic : ns->members)
+            generic->toCpp(*hpp, namespaceName, ns->aliases, noSystemC);
+
+        hpp->decreaseIndent();
+        hpp->addWithIndent("}\n");
+    };
+
+    bool ranInParallel = false;
+#if defined(SLANG_USE_THREADS)
+    if (numThreads != 1 && jobs.size() > 1) {
+        // Generating code only reads the AST, which is fully
+        // elaborated by now; make sure nothing tries to change it.
+        compilation->freeze();
+
+        BS::thread_pool<> threadPool(numThreads);
+        threadPool.submit_loop(size_t(0), jobs.size(), generate).get();
+        ranInParallel = true;
+    }
+#endif
 
-        hpp.decreaseIndent();
-        hpp.addWithIndent("}\n");
+    if (!ranInParallel) {
+        for (size_t i = 0; i < jobs.size(); i++)
+            generate(i);
     }
 }
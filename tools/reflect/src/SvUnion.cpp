@@ -14,14 +14,14 @@ void SvUnion::toCpp(HppFile& hppFile, std::string_view _namespace, const SvAlias
     //* UNION DECLARATION **/
     auto unionName = isCppReserved(type.name) ? fmt::format("_{}", type.name)
                                               : std::string(type.name);
-    hppFile.addWithIndent(fmt::format("struct {} {{\n", unionName));
+    hppFile.addWithIndent("struct {} {{\n", unionName);
     hppFile.increaseIndent();
 
     std::vector<std::pair<std::string, SvType>> members;
 
     const size_t unionSize = type.getBitstreamWidth();
     const auto cppType = CppType::fromSize(unionSize);
-    hppFile.addWithIndent(fmt::format("static constexpr size_t _size = {};\n\n", unionSize));
+    hppFile.addWithIndent("static constexpr size_t _size = {};\n\n", unionSize);
 
     if (cppType == CppType::SC_BV && noSystemC) {
         slang::OS::printE(fmt::format("Headers for the union {} can not be generated without "
@@ -34,7 +34,7 @@ void SvUnion::toCpp(HppFile& hppFile, std::string_view _namespace, const SvAlias
                                      : toString(cppType);
 
     // Create a sc bit vector to store the data of the Union
-    hppFile.addWithIndent(fmt::format("{} union_data;\n\n", cppTypeStr));
+    hppFile.addWithIndent("{} union_data;\n\n", cppTypeStr);
 
     // Check if some headers need to be included
     for (const auto& member : type.getCanonicalType().as<slang::ast::Scope>().members()) {
@@ -52,11 +52,11 @@ void SvUnion::toCpp(HppFile& hppFile, std::string_view _namespace, const SvAlias
     }
 
     //** GENERATE DEFAULT CONSTRUCTOR **//
-    hppFile.addWithIndent(fmt::format("{}() = default;\n\n", unionName));
+    hppFile.addWithIndent("{}() = default;\n\n", unionName);
 
     //** GENERATE CONSTRUCTOR **//
     {
-        hppFile.addWithIndent(fmt::format("{}(const {}& __data) {{\n", unionName, cppTypeStr));
+        hppFile.addWithIndent("{}(const {}& __data) {{\n", unionName, cppTypeStr);
 
         hppFile.increaseIndent();
 
@@ -70,8 +70,8 @@ void SvUnion::toCpp(HppFile& hppFile, std::string_view _namespace, const SvAlias
     // Note: This constructor will be generated only if the other constructor is not already
     // from a sc_bv
     if (!noSystemC && unionSize <= 64) {
-        hppFile.addWithIndent(
-            fmt::format("{}(const sc_bv<{}>& __data) {{\n", unionName, type.getBitstreamWidth()));
+        hppFile.addWithIndent("{}(const sc_bv<{}>& __data) {{\n", unionName,
+                              type.getBitstreamWidth());
 
         hppFile.increaseIndent();
 
@@ -85,12 +85,12 @@ void SvUnion::toCpp(HppFile& hppFile, std::string_view _namespace, const SvAlias
 
     // Base serializer for the inner type of the Union
     if (cppType == CppType::SC_BV) {
-        hppFile.addWithIndent(fmt::format("operator {}() const {{\n", cppTypeStr));
+        hppFile.addWithIndent("operator {}() const {{\n", cppTypeStr);
         hppFile.increaseIndent();
-        hppFile.addWithIndent(fmt::format("return sc_bv<{}>(union_data);\n", unionSize));
+        hppFile.addWithIndent("return sc_bv<{}>(union_data);\n", unionSize);
     }
     else {
-        hppFile.addWithIndent(fmt::format("operator {}() const {{\n", cppTypeStr));
+        hppFile.addWithIndent("operator {}() const {{\n", cppTypeStr);
         hppFile.increaseIndent();
         hppFile.addWithIndent("return union_data;\n");
     }
@@ -110,10 +110,10 @@ void SvUnion::toCpp(HppFile& hppFile, std::string_view _namespace, const SvAlias
             memberTypes.insert(memberTypeName);
 
             if (_namespace != memberType._namespace)
-                hppFile.addWithIndent(fmt::format("operator {}::{}() const {{\n",
-                                                  memberType._namespace, memberTypeName));
+                hppFile.addWithIndent("operator {}::{}() const {{\n", memberType._namespace,
+                                      memberTypeName);
             else
-                hppFile.addWithIndent(fmt::format("operator {}() const {{\n", memberTypeName));
+                hppFile.addWithIndent("operator {}() const {{\n", memberTypeName);
 
             hppFile.increaseIndent();
 
@@ -121,18 +121,17 @@ void SvUnion::toCpp(HppFile& hppFile, std::string_view _namespace, const SvAlias
 
             if (memberType.isStructEnumOrUnion()) {
                 if (_namespace != memberType._namespace)
-                    hppFile.addWithIndent(fmt::format("return {}::{}({});\n", memberType._namespace,
-                                                      memberTypeName, unionVariable));
+                    hppFile.addWithIndent("return {}::{}({});\n", memberType._namespace,
+                                          memberTypeName, unionVariable);
                 else
-                    hppFile.addWithIndent(
-                        fmt::format("return {}({});\n", memberTypeName, unionVariable));
+                    hppFile.addWithIndent("return {}({});\n", memberTypeName, unionVariable);
             }
             else {
                 if (unionSize > 64)
-                    hppFile.addWithIndent(fmt::format("return {};\n", unionVariable));
+                    hppFile.addWithIndent("return {};\n", unionVariable);
                 else
-                    hppFile.addWithIndent(fmt::format("return static_cast<{}>({});\n",
-                                                      memberTypeName, unionVariable));
+                    hppFile.addWithIndent("return static_cast<{}>({});\n", memberTypeName,
+                                          unionVariable);
             }
 
             hppFile.decreaseIndent();
@@ -146,11 +145,10 @@ void SvUnion::toCpp(HppFile& hppFile, std::string_view _namespace, const SvAlias
             auto memberTypeName = memberType.toString();
 
             if (_namespace != memberType._namespace)
-                hppFile.addWithIndent(fmt::format("{}::{} {}() const {{\n", memberType._namespace,
-                                                  memberTypeName, memberName));
+                hppFile.addWithIndent("{}::{} {}() const {{\n", memberType._namespace,
+                                      memberTypeName, memberName);
             else
-                hppFile.addWithIndent(
-                    fmt::format("{} {}() const {{\n", memberTypeName, memberName));
+                hppFile.addWithIndent("{} {}() const {{\n", memberTypeName, memberName);
 
             hppFile.increaseIndent();
 
@@ -158,18 +156,17 @@ void SvUnion::toCpp(HppFile& hppFile, std::string_view _namespace, const SvAlias
 
             if (memberType.isStructEnumOrUnion()) {
                 if (_namespace != memberType._namespace)
-                    hppFile.addWithIndent(fmt::format("return {}::{}({});\n", memberType._namespace,
-                                                      memberTypeName, unionVariable));
+                    hppFile.addWithIndent("return {}::{}({});\n", memberType._namespace,
+                                          memberTypeName, unionVariable);
                 else
-                    hppFile.addWithIndent(
-                        fmt::format("return {}({});\n", memberTypeName, unionVariable));
+                    hppFile.addWithIndent("return {}({});\n", memberTypeName, unionVariable);
             }
             else {
                 if (unionSize > 64)
-                    hppFile.addWithIndent(fmt::format("return {};\n", unionVariable));
+                    hppFile.addWithIndent("return {};\n", unionVariable);
                 else
-                    hppFile.addWithIndent(fmt::format("return static_cast<{}>({});\n",
-                                                      memberTypeName, unionVariable));
+                    hppFile.addWithIndent("return static_cast<{}>({});\n", memberTypeName,
+                                          unionVariable);
             }
 
             hppFile.decreaseIndent();
@@ -184,16 +181,16 @@ void SvUnion::toCpp(HppFile& hppFile, std::string_view _namespace, const SvAlias
     bool first = true;
     for (const auto& [memberName, memberType] : members) {
         if (first)
-            hppFile.addWithIndent(fmt::format("ss << \"{0}\" << \" = \" << ", memberName));
+            hppFile.addWithIndent("ss << \"{0}\" << \" = \" << ", memberName);
         else
-            hppFile.addWithIndent(fmt::format("ss << \" {0}\" << \" = \" << ", memberName));
+            hppFile.addWithIndent("ss << \" {0}\" << \" = \" << ", memberName);
 
         if (memberType.cppType == CppType::SC_BV)
-            hppFile.add(fmt::format("static_cast<{}::{}>(*this).to_string();\n",
-                                    memberType._namespace, memberType.name, memberName));
+            hppFile.add("static_cast<{}::{}>(*this).to_string();\n", memberType._namespace,
+                        memberType.name, memberName);
         else
-            hppFile.add(fmt::format("static_cast<{}::{}>(*this);\n", memberType._namespace,
-                                    memberType.name, memberName));
+            hppFile.add("static_cast<{}::{}>(*this);\n", memberType._namespace, memberType.name,
+                        memberName);
 
         first = false;
     }
@@ -202,8 +199,8 @@ void SvUnion::toCpp(HppFile& hppFile, std::string_view _namespace, const SvAlias
     hppFile.addWithIndent("}\n\n");
 
     //* OVERLOAD << OPERATOR *//
-    hppFile.addWithIndent(fmt::format(
-        "friend std::ostream& operator<<(std::ostream& os, const {}& __data) {{\n", unionName));
+    hppFile.addWithIndent(
+        "friend std::ostream& operator<<(std::ostream& os, const {}& __data) {{\n", unionName);
     hppFile.increaseIndent();
     hppFile.addWithIndent("os << __data.to_string();\n");
     hppFile.addWithIndent("return os;\n");
@@ -32,6 +32,10 @@ int main(int argc, char** argv) {
     driver.cmdLine.add("--stdout", toStdout, "Prints output in the stdout");
     std::optional<bool> verbose;
     driver.cmdLine.add("--verbose", verbose, "Outputs information about the process");
+    std::optional<bool> incremental;
+    driver.cmdLine.add("--incremental", incremental,
+                       "Skips regenerating headers in the output directory whose source types "
+                       "haven't changed since they were generated");
     std::optional<bool> noSystemC;
     driver.cmdLine.add(
         "--no-sc", noSystemC,
@@ -88,7 +92,12 @@ int main(int argc, char** argv) {
 
     const bool noSc = noSystemC.has_value() && noSystemC.value();
 
-    auto reflector = SvTypeReflector(std::move(compilation), info, noSc);
+    std::optional<fs::path> incrementalDir;
+    if (incremental == true && !(toStdout && *toStdout))
+        incrementalDir = outputPath;
+
+    auto reflector = SvTypeReflector(std::move(compilation), info, noSc,
+                                     driver.options.numThreads.value_or(0), incrementalDir);
     reflector.reflect();
 
     if (toStdout && *toStdout) {
@@ -15,6 +15,7 @@
 #endif
 
 #include <fmt/format.h>
+#include <iostream>
 #include <optional>
 
 #include "slang/driver/Driver.h"
@@ -44,6 +45,8 @@ int main(int argc, char** argv) {
         std::optional<bool> includeMissing;
         std::optional<bool> includeSkipped;
 
+        std::optional<bool> lineDirectives;
+
         driver::Driver driver;
         driver.addStandardArgs();
 
@@ -71,6 +74,11 @@ int main(int argc, char** argv) {
         driver.cmdLine.add("--exclude-skipped", includeSkipped,
                            "Exclude skipped (error) nodes in output");
 
+        // Source mapping options
+        driver.cmdLine.add("--line-directives", lineDirectives,
+                           "Emit `line directives in output wherever the printed text switches "
+                           "between source files");
+
         if (!driver.parseCommandLine(argc, argv))
             return 1;
 
@@ -100,7 +108,14 @@ int main(int argc, char** argv) {
         // By default print the last tree given (some flag files may pass syntax trees)
         auto tree = driver.syntaxTrees.back();
 
-        SyntaxPrinter printer(driver.sourceManager);
+        // Make sure we reproduce newlines correctly on Windows:
+#if defined(_WIN32)
+        _setmode(_fileno(stdout), _O_BINARY);
+#endif
+
+        // Stream output as it's printed instead of building up the whole
+        // file in memory, which matters when expanding large designs.
+        SyntaxPrinter printer(driver.sourceManager, std::cout);
 
         printer.setIncludeDirectives(true);
         printer.setSquashNewlines(false);
@@ -122,14 +137,13 @@ int main(int argc, char** argv) {
             printer.setIncludeMissing(true);
         if (includeSkipped == true)
             printer.setIncludeSkipped(true);
+        if (lineDirectives == true)
+            printer.setEmitLineDirectives(true);
 
-        // Make sure we reproduce newlines correctly on Windows:
-#if defined(_WIN32)
-        _setmode(_fileno(stdout), _O_BINARY);
-#endif
-
-        printf("%s", printer.print(*tree).str().c_str());
-        return 0;
+        printer.print(*tree);
+        printer.flush();
+        std::cout.flush();
+        return std::cout ? 0 : 1;
     }
     SLANG_CATCH(const std::exception& e) {
         SLANG_REPORT_EXCEPTION(e, "internal compiler error (exception): {}\n");
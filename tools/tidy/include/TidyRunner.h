@@ -0,0 +1,45 @@
+//------------------------------------------------------------------------------
+//! @file TidyRunner.h
+//! @brief Runs a set of slang-tidy checks over a compilation
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include "TidyFactory.h"
+#include <chrono>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace slang::ast {
+class Compilation;
+}
+
+/// The outcome of running a single check.
+struct TidyCheckRun {
+    std::unique_ptr<TidyCheck> check;
+    bool ok = true;
+    std::chrono::duration<double, std::milli> elapsed{};
+};
+
+/// The outcome of running a set of checks.
+struct TidyRunResult {
+    /// One entry per check, in the order the checks were requested.
+    std::vector<TidyCheckRun> runs;
+
+    /// Whether the checks were run concurrently.
+    bool ranInParallel = false;
+};
+
+/// Creates the named checks and runs each of them over the given compilation.
+///
+/// The compilation must be frozen and fully elaborated, with @a analysisManager
+/// having already analyzed it. Checks only read from the AST, so when
+/// @a numThreads is not 1 they are run concurrently.
+TidyRunResult runTidyChecks(std::span<const std::string> checkNames,
+                            const slang::ast::Compilation& compilation,
+                            const slang::analysis::AnalysisManager& analysisManager,
+                            uint32_t numThreads);
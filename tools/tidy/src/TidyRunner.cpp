@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+
+#include "TidyRunner.h"
+
+#if defined(SLANG_USE_THREADS)
+#    include <BS_thread_pool.hpp>
+#endif
+
+#include "slang/analysis/AnalysisManager.h"
+#include "slang/ast/Compilation.h"
+
+using namespace slang;
+
+TidyRunResult runTidyChecks(std::span<const std::string> checkNames,
+                            const ast::Compilation& compilation,
+                            const analysis::AnalysisManager& analysisManager, uint32_t numThreads) {
+    // Checks share the AST, so it must not change underneath them. Anything
+    // a check could trigger to be lazily created has to already exist by
+    // now, which freezing after full elaboration guarantees; in debug builds
+    // any allocation from the frozen compilation will assert.
+    SLANG_ASSERT(compilation.isFrozen());
+
+    TidyRunResult result;
+    auto& checkRuns = result.runs;
+    for (auto& name : checkNames)
+        checkRuns.push_back({Registry::create(name)});
+
+    auto& root = compilation.getRootNoFinalize();
+    auto runCheck = [&](size_t index) {
+        auto& run = checkRuns[index];
+        auto start = std::chrono::steady_clock::now();
+        run.ok = run.check->check(root, analysisManager);
+        run.elapsed = std::chrono::steady_clock::now() - start;
+    };
+
+#if defined(SLANG_USE_THREADS)
+    if (numThreads != 1 && checkRuns.size() > 1) {
+        BS::thread_pool<> threadPool(numThreads);
+        threadPool.detach_loop(size_t(0), checkRuns.size(), runCheck);
+        threadPool.wait();
+        result.ranInParallel = true;
+    }
+#endif
+
+    if (!result.ranInParallel) {
+        for (size_t i = 0; i < checkRuns.size(); i++)
+            runCheck(i);
+    }
+
+    return result;
+}
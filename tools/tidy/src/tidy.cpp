@@ -10,6 +10,7 @@
 #include "TidyConfigPrinter.h"
 #include "TidyFactory.h"
 #include "TidyKind.h"
+#include "TidyRunner.h"
 #include "fmt/color.h"
 #include "fmt/format.h"
 #include <algorithm>
@@ -70,6 +71,10 @@ int main(int argc, char** argv) {
     std::optional<std::string> infoCode;
     driver.cmdLine.add("--code", infoCode, "print information about the error or warning.");
 
+    std::optional<bool> timeChecks;
+    driver.cmdLine.add("--time-checks", timeChecks,
+                       "Print a summary of how long each check took to run.");
+
     if (!driver.parseCommandLine(argc, argv))
         return 1;
 
@@ -238,23 +243,26 @@ int main(int argc, char** argv) {
     // Set the sourceManager to the Registry so checks can access it
     Registry::setSourceManager(compilation->getSourceManager());
 
+    // Run all of the enabled checks up front, concurrently if allowed;
+    // results are reported below in the original order.
+    auto [checkRuns, ranInParallel] = runTidyChecks(Registry::getEnabledChecks(), *compilation,
+                                                    *analysisManager,
+                                                    driver.options.numThreads.value_or(0));
+
     int retCode = 0;
 
-    // Check all enabled checks
+    // Report the results of all enabled checks
     auto& tdc = *driver.textDiagClient;
-    for (const auto& checkName : Registry::getEnabledChecks()) {
+    for (const auto& [check, checkOk, _] : checkRuns) {
         tdc.clear();
         driver.diagEngine.clearIncludeStack();
 
-        const auto check = Registry::create(checkName);
-
         if (!quiet)
             OS::print(fmt::format("[{}]", check->name()));
 
         driver.diagEngine.setMessage(check->diagCode(), check->diagMessage());
         driver.diagEngine.setSeverity(check->diagCode(), check->diagSeverity());
 
-        auto checkOk = check->check(compilation->getRoot(), *analysisManager);
         if (!checkOk) {
 
             if (!quiet) {
@@ -297,6 +305,15 @@ int main(int argc, char** argv) {
         }
     }
 
+    if (timeChecks == true) {
+        std::ranges::stable_sort(checkRuns, [](auto& a, auto& b) { return a.elapsed > b.elapsed; });
+
+        OS::print(fmt::format("\nCheck times ({} {}):\n", checkRuns.size(),
+                              ranInParallel ? "checks run in parallel" : "checks run serially"));
+        for (auto& run : checkRuns)
+            OS::print(fmt::format("  {:>10.3f} ms  {}\n", run.elapsed.count(), run.check->name()));
+    }
+
     return retCode;
 }
 
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+
+#include "Test.h"
+#include "TidyFactory.h"
+#include "TidyRunner.h"
+
+#include "slang/analysis/AnalysisManager.h"
+
+TEST_CASE("TidyRunner: Concurrent checks match serial checks") {
+    auto tree = SyntaxTree::fromText(R"(
+class C #(parameter int N = 1);
+    int q[$];
+    function int get(int i); return q[i] + N; endfunction
+endclass
+
+module sub(input logic clk, input logic [3:0] in, output logic [3:0] out);
+    always_ff @(posedge clk) out = in;
+    always_comb begin
+        out <= in;
+    end
+endmodule
+
+module top(input logic clk, rst, input logic [3:0] a, output logic [3:0] y);
+    logic [3:0] r, l;
+    C #(4) c = new;
+
+    always_ff @(posedge clk or negedge rst) begin
+        if (!rst) r <= '0;
+        else r <= a;
+    end
+
+    always_latch if (clk) l = a;
+
+    always @* y = r;
+
+    for (genvar i = 0; i < 2; i++) begin
+        sub s(.*);
+    end
+
+    generate
+        if (1) sub u(.clk, .in(a), .out());
+    endgenerate
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    compilation.getAllDiagnostics();
+    compilation.freeze();
+
+    analysis::AnalysisManager analysisManager;
+    analysisManager.analyze(compilation);
+
+    TidyConfig config;
+    Registry::setConfig(config);
+    Registry::setSourceManager(compilation.getSourceManager());
+
+    auto checkNames = Registry::getRegisteredChecks();
+    std::ranges::sort(checkNames);
+    REQUIRE(checkNames.size() > 1);
+
+    auto [serial, serialInParallel] = runTidyChecks(checkNames, compilation, analysisManager, 1);
+    CHECK(!serialInParallel);
+
+    auto [parallel, parallelInParallel] = runTidyChecks(checkNames, compilation, analysisManager,
+                                                        4);
+#if defined(SLANG_USE_THREADS)
+    CHECK(parallelInParallel);
+#endif
+
+    REQUIRE(serial.size() == checkNames.size());
+    REQUIRE(parallel.size() == checkNames.size());
+
+    bool anyFailed = false;
+    for (size_t i = 0; i < checkNames.size(); i++) {
+        INFO(checkNames[i]);
+        CHECK(serial[i].check->name() == parallel[i].check->name());
+        CHECK(serial[i].ok == parallel[i].ok);
+        anyFailed |= !serial[i].ok;
+
+        auto& serialDiags = serial[i].check->getDiagnostics();
+        auto& parallelDiags = parallel[i].check->getDiagnostics();
+        REQUIRE(serialDiags.size() == parallelDiags.size());
+        for (size_t j = 0; j < serialDiags.size(); j++) {
+            CHECK(serialDiags[j].code == parallelDiags[j].code);
+            CHECK(serialDiags[j].location == parallelDiags[j].location);
+        }
+    }
+
+    // Make sure the design actually exercised some checks.
+    CHECK(anyFailed);
+}